@@ -636,6 +636,12 @@ void SetDefaults(ConfigStruct *config)
     config->Fw          = DEFAULT_Fw; 
     config->Ft          = DEFAULT_Ft;
     config->attenuation = DEFAULT_attenuation;
+    config->Fz1         = DEFAULT_Fz1;
+    config->Fz2         = DEFAULT_Fz2;
+    config->Nz          = DEFAULT_Nz;
+    config->Np          = DEFAULT_Np;
+    config->wisdom      = DEFAULT_wisdom;
+    config->wincache    = DEFAULT_wincache;
 }
 
 
@@ -733,6 +739,11 @@ void ExecuteAnalysis(ConfigStruct *C)
         sprintf(cmdstr[argcount++], "%.3lf", C->Ft);
     }
 
+    if(C->Nz > 0) {
+        strcpy(cmdstr[argcount++], "-z");
+        sprintf(cmdstr[argcount++], "%.3lf,%.3lf,%ld", C->Fz1, C->Fz2, C->Nz);
+    }
+
     strcpy(cmdstr[argcount++], "-f");
     sprintf(cmdstr[argcount++], "%s", C->filename);
 
@@ -57,7 +57,7 @@ int SetConfiguration (int argc, char **argv, ConfigStruct *config)
    
     /* Option character returned by getopt (see man getopt(3S)) */
     int option, window_specified=FALSE, winchar;
-    char *wstr;
+    char *wstr, *fstr, *fend;
     extern char *optarg;
     extern int optind;
     KaiserParamStruct params;
@@ -87,11 +87,17 @@ int SetConfiguration (int argc, char **argv, ConfigStruct *config)
     config->filename    = DEFAULT_filename;
     config->wfilename   = DEFAULT_winfilename;
     config->plotprog    = DEFAULT_plotprog;
+    config->wisdom      = DEFAULT_wisdom;
+    config->wincache    = DEFAULT_wincache;
     config->removeplot  = DEFAULT_removeplot;
-    config->windowfunc  = DEFAULT_windowfunc;
+    config->window      = DEFAULT_winchar;
     config->Xgraph      = DEFAULT_Xgraph;
     config->normalise   = DEFAULT_normalise;
     config->symimpulse  = DEFAULT_symimpulse;
+    config->Fz1         = DEFAULT_Fz1;
+    config->Fz2         = DEFAULT_Fz2;
+    config->Nz          = DEFAULT_Nz;
+    config->Np          = DEFAULT_Np;
     wstr                = DEFAULT_wstr;
     winchar             = DEFAULT_winchar;
 
@@ -105,7 +111,7 @@ int SetConfiguration (int argc, char **argv, ConfigStruct *config)
     config->wfp = stderr;
 
     /* Loop through all options specified */
-    while((option = getopt(argc, argv, "R:D:f:dnmpSx:b:riIWuw:c:s:a:Q:N:XP:")) != EOF) {
+    while((option = getopt(argc, argv, "R:D:f:dnmpSx:b:riIWuw:c:s:a:Q:N:XP:z:F:t:M:")) != EOF) {
        /* Set globals based on returned option and arguments where applicable */
        switch(option) {
            case 'P':
@@ -246,6 +252,50 @@ int SetConfiguration (int argc, char **argv, ConfigStruct *config)
                    ErrorAction(BADSTATUS);
                }
                break;
+           case 'z':
+               config->Nz = DEFAULT_ZOOMPOINTS;
+               if(sscanf(optarg, "%lf,%lf,%ld", &config->Fz1, &config->Fz2, &config->Nz) < 2) {
+                   sprintf(sbuf[0], "%s: Error! Zoom band must be given as <f1>,<f2>[,<points>]\n", argv[0]);
+                   DisplayMessage(1, (char **)&sbufptr);
+                   ErrorAction(BADSTATUS);
+               }
+               if(config->Nz < 2 || config->Nz > COEFFTOTAL) {
+                   sprintf(sbuf[0], "%s: Error! Zoom points must be from 2 to %d\n", argv[0], COEFFTOTAL);
+                   DisplayMessage(1, (char **)&sbufptr);
+                   ErrorAction(BADSTATUS);
+               }
+               break;
+           case 'F':
+               /* Comma separated list of frequencies */
+               config->Np = 0;
+               fstr = optarg;
+               do {
+                   if(config->Np == MAXPROBES) {
+                       sprintf(sbuf[0], "%s: Error! No more than %d probe frequencies may be given\n", argv[0], MAXPROBES);
+                       DisplayMessage(1, (char **)&sbufptr);
+                       ErrorAction(BADSTATUS);
+                       break;
+                   }
+                   config->Fp[config->Np++] = strtod(fstr, &fend);
+                   if(fend == fstr) {
+                       sprintf(sbuf[0], "%s: Error! Probe frequencies must be given as <f1>[,<f2>...]\n", argv[0]);
+                       DisplayMessage(1, (char **)&sbufptr);
+                       ErrorAction(BADSTATUS);
+                       break;
+                   }
+                   fstr = fend;
+               } while(*fstr++ == ',');
+               break;
+           case 't':
+               config->wisdom = optarg;
+               break;
+           case 'M':
+               if(sscanf(optarg, "%ld", &config->wincache) != 1 || config->wincache < 0) {
+                   sprintf(sbuf[0], "%s: Error! Window cache size must be 0 or more Kbytes\n", argv[0]);
+                   DisplayMessage(1, (char **)&sbufptr);
+                   ErrorAction(BADSTATUS);
+               }
+               break;
            case 'u':
                DisplayUsage(argv);
                ErrorAction(GOODSTATUS);
@@ -280,6 +330,28 @@ int SetConfiguration (int argc, char **argv, ConfigStruct *config)
         DisplayMessage(1, (char **)&sbufptr);
         ErrorAction(BADSTATUS);
     }
+    if(config->Nz && (config->Fz1 < 0.0 || config->Fz2 <= config->Fz1 || config->Fz2 > config->Fs/2)) {
+        sprintf(sbuf[0], "%s: Error! Zoom band must rise within 0 to Fs/2\n", argv[0]);
+        DisplayMessage(1, (char **)&sbufptr);
+        ErrorAction(BADSTATUS);
+    }
+    if(config->Nz && config->opimpulse) {
+        sprintf(sbuf[0], "%s: Error! Can't zoom when outputting the impulse response\n", argv[0]);
+        DisplayMessage(1, (char **)&sbufptr);
+        ErrorAction(BADSTATUS);
+    }
+    for(n = 0; n < config->Np; n++)
+        if(config->Fp[n] < 0.0 || config->Fp[n] > config->Fs/2) {
+            sprintf(sbuf[0], "%s: Error! Probe frequencies must be within 0 to Fs/2\n", argv[0]);
+            DisplayMessage(1, (char **)&sbufptr);
+            ErrorAction(BADSTATUS);
+            break;
+        }
+    if(config->Np && (config->Nz || config->opimpulse)) {
+        sprintf(sbuf[0], "%s: Error! Can't probe frequencies with zoom or impulse output\n", argv[0]);
+        DisplayMessage(1, (char **)&sbufptr);
+        ErrorAction(BADSTATUS);
+    }
     if((config->decibels && (config->magnitude || config->phase)) ||
        (config->magnitude && config->phase)) {
         sprintf(sbuf[0], "%s: Error! Must specify only one of -d, -m or -p options\n", argv[0]);
@@ -309,7 +381,7 @@ int SetConfiguration (int argc, char **argv, ConfigStruct *config)
         config->N = params.N;
 
         /* Auto-design mode is a Kaiser window */
-        config->windowfunc = kaiser;
+        config->window = 'k';
         wstr = "Kaiser";
     }
 
@@ -376,13 +448,14 @@ int SetConfiguration (int argc, char **argv, ConfigStruct *config)
 
 void DisplayUsage(char **argv)
 {
-    static char sbuf[200][80], *sbufptr[1];
+    static char sbuf[200][80], *sbufptr[200];
     int n = 0, i;
 
     sprintf(sbuf[n++], "\nUsage: %s [-unWirIXS] [-w <window>] [-a <num>]\n", argv[0]);
     sprintf(sbuf[n++], "              [-Q <num>] [-N <num>] [-d | -m | -p] [-c <num>]\n");
     sprintf(sbuf[n++], "              [-b <num> | -x <num>] [-s <num>] [-f <filename>]\n");
-    sprintf(sbuf[n++], "              [-R <num> -D <num>]\n");
+    sprintf(sbuf[n++], "              [-R <num> -D <num>] [-z <num>,<num>[,<num>]]\n");
+    sprintf(sbuf[n++], "              [-F <num>[,<num>...]] [-t <filename>] [-M <num>]\n");
     sprintf(sbuf[n++], "\n        -a Window parameter\n");
     sprintf(sbuf[n++], "        -i Perform spectral inversion (default off)\n");
     sprintf(sbuf[n++], "        -r Perform spectral reversal (default off)\n");
@@ -424,6 +497,12 @@ void DisplayUsage(char **argv)
     sprintf(sbuf[n++], "           (default non-automode)\n");
     sprintf(sbuf[n++], "        -D Auto-design mode maximum transition (delta) frequency step in Hz\n");
     sprintf(sbuf[n++], "           (default non-automode)\n");
+    sprintf(sbuf[n++], "        -z Output frequency response only from f1 to f2 Hz, at finer\n");
+    sprintf(sbuf[n++], "           resolution, over the given number of points (default %d)\n", DEFAULT_ZOOMPOINTS);
+    sprintf(sbuf[n++], "        -F Output frequency response only at the listed frequencies in Hz\n");
+    sprintf(sbuf[n++], "           (up to %d), relative to the nominal pass band gain\n", MAXPROBES);
+    sprintf(sbuf[n++], "        -t Tune FFTs on first use, keeping the fastest in a wisdom file\n");
+    sprintf(sbuf[n++], "        -M Window cache size in Kbytes (default %d)\n", DEFAULT_wincache);
     sprintf(sbuf[n++], "        -X Output to graphical display (default off) \n");
     sprintf(sbuf[n++], "        -u Print this message\n");
     sprintf(sbuf[n++], "\n");
@@ -491,8 +570,11 @@ static void DisplayBanner(const ConfigStruct *C, const char *wstr)
 static void GetEnvironment(ConfigStruct *C, char **wstr, char **argv)
 {
     static void SetWindow(ConfigStruct *, char **, char **, char);
+    static char sbuf[1][80], *sbufptr[1];
     char *str;
 
+    sbufptr[0] = (char *)&sbuf[0];
+
     if((str = getenv("FLT_XPLOT")) != NULL)
         C->plotprog = str;
 
@@ -514,6 +596,17 @@ static void GetEnvironment(ConfigStruct *C, char **wstr, char **argv)
     if((str = getenv("FLT_ALPHA")) != NULL)
         sscanf(str, "%lf", &(C->a));
 
+    if((str = getenv("FLT_WISDOM")) != NULL)
+        C->wisdom = str;
+
+    if((str = getenv("FLT_WINCACHE")) != NULL) {
+        if(sscanf(str, "%ld", &C->wincache) != 1 || C->wincache < 0) {
+            sprintf(sbuf[0], "%s: Error! Window cache size must be 0 or more Kbytes\n", argv[0]);
+            DisplayMessage(1, (char **)&sbufptr);
+            ErrorAction(BADSTATUS);
+        }
+    }
+
     if((str = getenv("FLT_WINDOW")) != NULL) {
         SetWindow(C, wstr, argv, str[0]);
     }
@@ -530,77 +623,77 @@ static void SetWindow(ConfigStruct *C, char **wstr, char **argv, char wchar)
 
     switch(wchar) {
         case 'o': 
-            C->windowfunc = bohman;
+            C->window = 'o';
             *wstr = "Bohman";
             break;
         case 'r':
-            C->windowfunc = reisz;
+            C->window = 'r';
             *wstr = "Reisz";
             break;
         case 'R':
-            C->windowfunc = riemann;
+            C->window = 'R';
             *wstr = "Riemann";
             break;
         case 'V':
-            C->windowfunc = vallepoisson;
+            C->window = 'V';
             *wstr = "Valle-Poisson";
             break;
         case 'T':
-            C->windowfunc = tukey;
+            C->window = 'T';
             *wstr = "Tukey";
             break;
         case 'p':
-            C->windowfunc = poisson;
+            C->window = 'p';
             *wstr = "Poisson";
             break;
         case 'c':
-            C->windowfunc = cauchy;
+            C->window = 'c';
             *wstr = "Cauchy";
             break;
         case 'C':
-            C->windowfunc = cosine;
+            C->window = 'C';
             *wstr = "Cosine";
             break;
         case 't':
-            C->windowfunc = bartlett;
+            C->window = 't';
             *wstr = "Bartlett";
             break;
         case 'b':
-            C->windowfunc = blackman;
+            C->window = 'b';
             *wstr = "Blackman";
             break;
         case 'n':
-            C->windowfunc = nuttall;
+            C->window = 'n';
             *wstr = "Nuttall";
             break;
         case 'B':
-            C->windowfunc = blackman_harris;
+            C->window = 'B';
             *wstr = "Blackman-Harris";
             break;
         case 'k':
-            C->windowfunc = kaiser;
+            C->window = 'k';
             *wstr = "Kaiser";
             break;
         case 'g':
-            C->windowfunc = gauss;
+            C->window = 'g';
             *wstr = "Gaussian";
             break;
         case 'v':
-            C->windowfunc = hamming;
+            C->window = 'v';
             C->a = VONHANN_ALPHA;
             *wstr = "von Hann";
             break;
         case 'u':
-            C->windowfunc = hamming;
+            C->window = 'u';
             C->a = UNIFORM_ALPHA;
             *wstr = "Uniform";
             break;
         case 'h':
-            C->windowfunc = hamming;
+            C->window = 'h';
             *wstr = "Hamming";
             break;
         case 'y':
-            C->windowfunc = chebyshev;
+            C->window = 'y';
             *wstr = "Chebyshev";
             break;
         default: 
@@ -27,10 +27,74 @@
 //
 // fft() uses fast fourier transform, but is restricted to
 // transforms with lengths a power of 2. Data may be padded
-// with zeros. 
+// with zeros. The stages are done in radix-4, with a single
+// radix-2 stage first for an odd number of stages.
 //
 // dft() is also supplied with the same interface as fft()
-// but will transform arbitrary sized data (albeit slowly).
+// but will transform arbitrary sized data. Lengths with only
+// factors of 2, 3, 5 and 7 use a mixed radix transform, and
+// others Bluestein's algorithm on top of the power of 2
+// transform.
+//
+// fft_plan_create() builds the bit reversal permutation and
+// the twiddle factors for each stage once, for a given length.
+// fft_plan_execute() then transforms data of that length with
+// no set up cost, and fft_plan_destroy() frees the plan. fft()
+// is a wrapper which keeps a plan for the last length used,
+// planned as any wisdom from fft_set_wisdom() says, with the
+// algorithm, SIMD level and six step use found fastest for
+// the length by fft_tune.c.
+//
+// fft_real() and fft_plan_execute_real() do a forward
+// transform of real data, as a half length complex transform
+// followed by a split pass, for about half the work of fft().
+//
+// fft_plan_create_alg() selects the algorithm for a plan:
+// FFT_ALG_DIT (the default) bit reverses the data and does
+// decimation in time stages in place; FFT_ALG_STOCKHAM uses
+// a Stockham autosort decimation in frequency, ping-ponging
+// with a work buffer, with no bit reversal pass. The latter
+// avoids the strided bit reversal swaps, which are cache
+// hostile for large transforms.
+//
+// The _pruned() variants of these functions are for data
+// where only the first 'nonzero' points may be non-zero (such
+// as a zero padded impulse response), and skip the early
+// stage butterflies which would only combine zeros.
+//
+// fft_batch() and fft_plan_execute_batch() transform a number
+// of same length arrays, held one after another, together:
+// each butterfly is done for several arrays at once, with a
+// single twiddle factor load, as one SIMD vector.
+//
+// fft_real_pruned_f() is as fft_real_pruned(), but does the
+// transform in single precision, using the split complex
+// functions of fft_split.c, for inputs which need no more
+// accuracy (e.g. quantised coefficients).
+//
+// fft_zoom() evaluates the spectrum of x[] at M points over
+// a band of frequencies, f1 to f2, with a chirp-z transform,
+// for a fine view of part of the spectrum without a large
+// zero padded transform. The input may be of any length.
+//
+// fft_probe() evaluates the spectrum of real x[] at a list of
+// arbitrary frequencies, each with a Goertzel recurrence, in
+// O(N) operations per frequency. For a few frequencies this
+// is far cheaper than a transform of all of them.
+//
+// The functions with an _r suffix are reentrant versions,
+// keeping the last length's plan, any error message and the
+// six step work buffer in a caller owned fft_ctx_t, set up
+// with fft_ctx_init() and released with fft_ctx_free(),
+// rather than in this file's own context, fft_global_ctx.
+// The functions without the suffix are wrappers passing
+// fft_global_ctx, so share state between all callers.
+// Executing a plan changes nothing but the data (a DIT plan
+// may be shared between threads, though not a Stockham plan,
+// which has a work buffer), apart from the split twiddle
+// factors, made under a lock on a plan's first split
+// execution (see fft_split.c). The SIMD level is found from
+// the CPU when a plan is created.
 //
 // PARAMETERS:
 //
@@ -44,20 +108,60 @@
 // inverse - int flag. If non-zero, inverse (synthesis)
 //           transform perfomed.
 //
+// nonzero - int count of leading points which may be non-zero,
+//           for the _pruned() functions. Points from nonzero
+//           to length-1 are not read.
+//
+// ctx - fft_ctx_t pointer for the _r functions. May be NULL
+//       for those not keeping a plan, discarding any error
+//       message.
+//
 // COMPILATION:
 //
 //   If compiled with COS_TABLE defined, the cosine/sine 
 //   calculations are done with a lookup table, which should
-//   speed up the calculations but limits the fft to 4096
-//   points.
+//   speed up the calculations. The table holds a quarter
+//   wave of COS_TABLE_LEN points per cycle (default 4096,
+//   and a power of 2), generated from the library cos()
+//   and sin() once, when the first plan is created, then
+//   shared read only by all threads. Lengths beyond the
+//   table's multiply its factors by a cos()/sin() factor
+//   for each fraction of a table step, so any length can
+//   be planned. The table is only referenced when a plan's
+//   twiddle factors are generated.
+//
+//   On x86 the radix-4 butterflies are done with SSE2 or
+//   AVX2/FMA, as selected when a plan is created from the
+//   CPUID feature flags, unless compiled with FFT_NO_SIMD
+//   defined. fft_set_simd() can force a lower level (such
+//   as FFT_SIMD_NONE for the scalar code). The SSE2 results
+//   are bit identical to the scalar code, but the AVX2 code
+//   uses fused multiply-adds, so may differ in the last bit.
+//
+//   DIT transforms of 4M points or more (as set with
+//   fft_set_sixstep(), but no less than 64K) are done with
+//   a cache blocked six step transform: column transforms,
+//   twiddle factors and row transforms, copying blocks of
+//   rows and columns so each transform is over contiguous
+//   data in cache, for two passes over memory rather than
+//   one per radix-4 stage. If compiled with OpenMP (e.g.
+//   /openmp or -fopenmp), the blocks are shared between
+//   threads, and with more than one thread all transforms
+//   of 64K points or more use it. fft_set_threads() sets
+//   the number of threads, defaulting to the OpenMP
+//   setting. The six step results may differ from the
+//   ordinary stages' in the last bit.
 //
 // RETURN:
 //
-//   Both fft() and dft() return either FFT_OKSTATUS or 
-//   FFT_ERRORSTATUS. For the latter, fft_error_msg points
-//   to an error message string. Subsequent calls to fft or
-//   dft will clear any previous message. Transformed data
-//   placed in array pointed to by x[].
+//   fft_plan_create() returns NULL on an error, setting
+//   fft_error_msg. The other functions return either
+//   FFT_OKSTATUS or FFT_ERRORSTATUS. For the latter,
+//   fft_error_msg (or ctx->msg, for the _r functions)
+//   points to an error message string.
+//   Subsequent calls to fft or dft will clear any previous
+//   message. Transformed data placed in array pointed to by
+//   x[].
 //
 //=============================================================
 
@@ -67,12 +171,33 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdarg.h>
 #include <math.h>
 
 #include "fft.h"
+#include "ivdep.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #ifdef COS_TABLE
-#include "cos_table.h"
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+#endif
+
+#if !defined(FFT_NO_SIMD) && (defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__))
+#define FFT_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
 #endif
 
 // -------------------------------------------------------------------------
@@ -95,122 +220,456 @@
     _R.i = _X.i - _Y.i;                 \
 }
 
+// Smallest plan length with the tables for the six step transform, and
+// the default smallest length to use it for with a single thread. Below
+// 4M points (64MB) the radix-4 stages mostly run from the last level
+// cache, and are the faster
+#define SIXSTEP_MIN     (1 << 16)
+#define SIXSTEP_DEFAULT (1 << 22)
+
+// Number of rows, or columns, each six step tile holds
+#define SIXSTEP_TILE 16
+
+// Points per cycle of the cosine table
+#if defined(COS_TABLE) && !defined(COS_TABLE_LEN)
+#define COS_TABLE_LEN 4096
+#endif
+
+#if defined(COS_TABLE) && (COS_TABLE_LEN < 8 || (COS_TABLE_LEN & (COS_TABLE_LEN - 1)))
+#error COS_TABLE_LEN must be a power of 2, no less than 8
+#endif
+
+// Number of transforms done together by fft_plan_execute_batch(),
+// one per vector lane
+#define BATCH_LANES 4
+
+// Number of frequencies fft_probe() evaluates together, their
+// independent recurrences filling the vector lanes
+#define PROBE_LANES 4
+
+// No aliasing qualifier, so the batch loops may be vectorised
+#if defined(_MSC_VER) || defined(__GNUC__)
+#define RESTRICT __restrict
+#else
+#define RESTRICT
+#endif
+
+// Largest radix, and most factors of a length, for the mixed radix DFT
+#define MAXRADIX   7
+#define MAXFACTORS 32
+
+// GCC and clang need functions using SSE2 (for 32 bit builds) and
+// AVX2/FMA intrinsics marking as such, whilst MSVC allows them anywhere
+#if defined(FFT_X86) && defined(__GNUC__)
+#define TARGET_SSE2 __attribute__((target("sse2")))
+#define TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#endif
+
+// Inlining into functions with a different target, so the inlined
+// code is compiled for that target
+#if defined(_MSC_VER)
+#define FORCE_INLINE __forceinline
+#elif defined(__GNUC__)
+#define FORCE_INLINE inline __attribute__((always_inline))
+#else
+#define FORCE_INLINE
+#endif
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+// Radix-4 stage function, for an n point stage over length points
+typedef void (*radix4_func_t)(complex_t x[], const complex_t W[], const int length, const int n);
+
 // -------------------------------------------------------------------------
 // PROTOTYPES
 // -------------------------------------------------------------------------
-static void bitrev (complex_t array[], const int N);
+static void bitrev     (complex_t array[], const fft_plan_t *plan, const int N);
+static void fft_stages (fft_ctx_t *ctx, const fft_plan_t *plan, complex_t array[], const int N, const int nonzero);
+static void stockham   (const fft_plan_t *plan, complex_t array[], const int N, const int nonzero);
+static void fft_stages_dit (const fft_plan_t *plan, complex_t array[], const int N, const int nonzero);
+static void six_step   (fft_ctx_t *ctx, const fft_plan_t *plan, complex_t array[], const int N, const int nonzero);
+static void six_step_copy (complex_t dst[], const int dstride, const complex_t src[], const int sstride,
+                           const int rows, const int cols);
+static FORCE_INLINE void batch_stages (const fft_plan_t *plan, real_t * RESTRICT re, real_t * RESTRICT im);
+#ifdef FFT_X86
+static void batch_stages_avx2 (const fft_plan_t *plan, real_t * RESTRICT re, real_t * RESTRICT im);
+#endif
+static fft_plan_t *last_plan (fft_ctx_t *ctx, const int N);
+static void fft_error (fft_ctx_t *ctx, const char *fmt, ...);
+static int  plan_simd (const fft_plan_t *plan);
+static void radix4_scalar (complex_t x[], const complex_t W[], const int N, const int n);
+#ifdef FFT_X86
+static void radix4_sse2   (complex_t x[], const complex_t W[], const int N, const int n);
+static void radix4_avx2   (complex_t x[], const complex_t W[], const int N, const int n);
+static int  cpu_simd      (void);
+#endif
+static int  factorise        (const int N, int factors[]);
+static int  mixed_radix      (fft_ctx_t *ctx, complex_t array[], const int N, const int factors[], const int inverse);
+static void mixed_radix_pass (complex_t out[], const complex_t in[], const int stride,
+                              const int factors[], const complex_t W[], const int N);
+static int  bluestein        (fft_ctx_t *ctx, complex_t array[], const int N, const int inverse);
+static double cycles         (const double f, const double m);
+#ifdef COS_TABLE
+static void cos_table_create (void);
+static void cos_table_fill   (void);
+static void table_twiddles   (complex_t W[], const int length);
+#endif
 
 // -------------------------------------------------------------------------
 // GLOBALS
 // -------------------------------------------------------------------------
 
-// Error messages
-static char msgbuf[256] = {0};
-char * fft_error_msg = msgbuf;
+// Plan, for the last requested length, and error message of fft(),
+// dft() and the other functions which are not reentrant
+static fft_ctx_t fft_global_ctx = {NULL, {0}, NULL, 0};
+char * fft_error_msg = fft_global_ctx.msg;
+
+// Highest SIMD level to use, as set by fft_set_simd()
+static int simd_limit = FFT_SIMD_AVX2;
+
+// Number of threads for six step transforms (0 for the OpenMP default)
+static int fft_threads = 0;
+
+// Smallest length using the six step transform with a single thread
+static int sixstep_length = SIXSTEP_DEFAULT;
 
 // -------------------------------------------------------------------------
-// fft()                                                     
+// fft()
+//
+// Transforms x[] using a plan for 'length' points, which
+// is only rebuilt when the length differs from the last
+// call.
 // -------------------------------------------------------------------------
 
 int fft (complex_t x[], const int length, const int inverse)
 {
-#ifdef COS_TABLE
-    // Size of the Cosine function table, and simple relations 
-    int tablelen, tablelen34, tablelen_1;
-#endif
+    return fft_r(&fft_global_ctx, x, length, inverse);
+}
 
-    // Indexes for the two points of the array in the butterfly
-    int idx, idx2;    
-    // The current size of DFT being processed (and divided by 2)
-    int n, ndiv2;     
-    // The current power Wn is raised to, for butterfly calculation
-    int k;            
-    // Value of W for current n and k, and value of W for n with k = 1
-    complex_t WkN, W1N; 
-    // Temporary complex_t number holder
-    complex_t tmp;
+// -------------------------------------------------------------------------
+// fft_r()
+//
+// Reentrant fft(), keeping the plan and any error message
+// in the caller's context.
+// -------------------------------------------------------------------------
 
-    // Clear error message
-    msgbuf[0] = '\0';
+int fft_r (fft_ctx_t *ctx, complex_t x[], const int length, const int inverse)
+{
+    if(last_plan(ctx, length) == NULL)
+        return FFT_ERRORSTATUS;
+
+    return fft_plan_execute_pruned_r(ctx, ctx->plan, x, length, inverse);
+}
+
+// -------------------------------------------------------------------------
+// fft_pruned()
+//
+// As fft(), but with only the first 'nonzero' points of x[]
+// non-zero.
+// -------------------------------------------------------------------------
+
+int fft_pruned (complex_t x[], const int length, const int nonzero, const int inverse)
+{
+    return fft_pruned_r(&fft_global_ctx, x, length, nonzero, inverse);
+}
+
+// -------------------------------------------------------------------------
+// fft_pruned_r()
+// -------------------------------------------------------------------------
 
-    // If length not a power of 2, return without performing FFT
-    idx2 = length-1;
-    if((length < 2) || (length & idx2)) {
-        sprintf(msgbuf, "fft(): Error! requested FFT length (%d) is not a power of 2", length);
+int fft_pruned_r (fft_ctx_t *ctx, complex_t x[], const int length, const int nonzero, const int inverse)
+{
+    if(last_plan(ctx, length) == NULL)
         return FFT_ERRORSTATUS;
+
+    return fft_plan_execute_pruned_r(ctx, ctx->plan, x, nonzero, inverse);
+}
+
+// -------------------------------------------------------------------------
+// fft_ctx_init()
+//
+// Sets up a context for the reentrant functions, with no
+// plan, no error message and no work buffer.
+// -------------------------------------------------------------------------
+
+void fft_ctx_init (fft_ctx_t *ctx)
+{
+    ctx->plan        = NULL;
+    ctx->msg[0]      = '\0';
+    ctx->scratch     = NULL;
+    ctx->scratch_len = 0;
+}
+
+// -------------------------------------------------------------------------
+// fft_ctx_free()
+//
+// Releases the plan and work buffer kept in a context. The
+// context may be used again afterwards.
+// -------------------------------------------------------------------------
+
+void fft_ctx_free (fft_ctx_t *ctx)
+{
+    fft_plan_destroy(ctx->plan);
+    free(ctx->scratch);
+    ctx->plan        = NULL;
+    ctx->scratch     = NULL;
+    ctx->scratch_len = 0;
+}
+
+// -------------------------------------------------------------------------
+// last_plan()
+//
+// Returns the plan kept in the context, rebuilding it only
+// when 'length' differs from the last call. Returns NULL on
+// an error.
+// -------------------------------------------------------------------------
+
+static fft_plan_t *last_plan (fft_ctx_t *ctx, const int length)
+{
+    // Clear error message
+    ctx->msg[0] = '\0';
+
+    if(ctx->plan == NULL || ctx->plan->length != length) {
+        fft_plan_destroy(ctx->plan);
+        ctx->plan = fft_plan_create_tuned_r(ctx, length);
     }
 
-#ifdef COS_TABLE
+    return ctx->plan;
+}
 
-    // Calculate size of cosine table directly from the array
-    tablelen   = sizeof(cos_table)/sizeof(cos_table[0]);
-    tablelen_1 = tablelen - 1;
-    tablelen34 = (3 * tablelen)/4;
+// -------------------------------------------------------------------------
+// fft_error()
+//
+// Formats an error message into the context's buffer, or
+// discards it for a NULL context.
+// -------------------------------------------------------------------------
 
-    // If length exceeds the size of the cosine lookup table, return without performing FFT
-    if(length > tablelen) {
-        sprintf(msgbuf, "fft(): Error! requested FFT length (%d) exceeds maximum of %d", length, tablelen);
-        return FFT_ERRORSTATUS;
+static void fft_error (fft_ctx_t *ctx, const char *fmt, ...)
+{
+    va_list args;
+
+    if(ctx != NULL) {
+        va_start(args, fmt);
+        vsprintf(ctx->msg, fmt, args);
+        va_end(args);
     }
-#endif
+}
 
-    // If inverse (synthesis) transform, pre-adjust values (conjugate)
-    if(inverse)
-        for(n = 0; n < length ; n++) 
-            x[n].i *= -1.0;
+// -------------------------------------------------------------------------
+// fft_plan_create()
+// -------------------------------------------------------------------------
 
-    // Calculate N/2
-    ndiv2 = length >> 1;
+fft_plan_t *fft_plan_create (const int length)
+{
+    return fft_plan_create_r(&fft_global_ctx, length, FFT_ALG_DIT);
+}
 
-    // Bit reverse array x
-    bitrev(x, length);
+// -------------------------------------------------------------------------
+// fft_plan_create_alg()
+//
+// Allocates a plan for 'length' points, using the given
+// algorithm, and calculates the bit reversed index of each
+// point and the twiddle factors for every stage. A Stockham
+// plan also gets a work buffer of 'length' points. Returns
+// NULL on an error.
+// -------------------------------------------------------------------------
 
-    // Loop for each 'n' point DFT stage
-    for(n = 2; n <= length; n <<= 1) {
-        ndiv2 = n>>1;    // n / 2
+fft_plan_t *fft_plan_create_alg (const int length, const int algorithm)
+{
+    return fft_plan_create_r(&fft_global_ctx, length, algorithm);
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_create_r()
+//
+// Reentrant fft_plan_create_alg(), setting any error message
+// in the caller's context.
+// -------------------------------------------------------------------------
 
-        // Initialise Wkn for k = 0
-        WkN.r = 1.0; WkN.i = 0.0;                      
+fft_plan_t *fft_plan_create_r (fft_ctx_t *ctx, const int length, const int algorithm)
+{
+    fft_plan_t *plan;
+    complex_t  *W, *W4;
+    int idx, a, b, n, ndiv2, k, m, j;
 
-#ifdef COS_TABLE
-        // Calculate Wkn for k = 1. cos_table maps 2*PI of cosine 
-        // from 0 to tablelen-1, and '+ 3tablelen/4' is 3/4 PI shift to 
-        // map -sine from cosine
-        W1N.r = cos_table[tablelen/n];                     
-        W1N.i = cos_table[(tablelen/n + tablelen34) & tablelen_1];  
+    // Clear error message
+    if(ctx != NULL)
+        ctx->msg[0] = '\0';
+
+    // If length not a power of 2, return without creating a plan
+    if((length < 2) || (length & (length-1))) {
+        fft_error(ctx, "fft(): Error! requested FFT length (%d) is not a power of 2", length);
+        return NULL;
+    }
+
+    if(algorithm != FFT_ALG_DIT && algorithm != FFT_ALG_STOCKHAM) {
+        fft_error(ctx, "fft(): Error! unknown FFT algorithm (%d)", algorithm);
+        return NULL;
+    }
+
+    // Obtain memory for the plan and its tables. An n point radix-2
+    // stage uses n/2 twiddle factors, giving length-1 over all stages.
+    // An n point radix-4 stage uses n/4 sets of three, giving fewer
+    // than 3 * length/2 for all n from 4 to length.
+    if((plan = calloc(1, sizeof(fft_plan_t))) == NULL                           ||
+       (plan->bitrev   = malloc(length * sizeof(int))) == NULL                  ||
+       (plan->twiddle  = malloc((length - 1) * sizeof(complex_t))) == NULL      ||
+       (plan->twiddle4 = malloc(3 * (length/2) * sizeof(complex_t))) == NULL      ||
+       (algorithm == FFT_ALG_STOCKHAM &&
+        (plan->work    = malloc(length * sizeof(complex_t))) == NULL)) {
+        fft_error(ctx, "fft(): Error! unable to allocate memory");
+        fft_plan_destroy(plan);
+        return NULL;
+    }
+
+    // Large DIT plans get a plan for the rows of the six step transform,
+    // with the sub-plan length the square root of the length, rounded up
+    if(algorithm == FFT_ALG_DIT && length >= SIXSTEP_MIN) {
+        for(n = 1; n * n < length; n <<= 1)
+            ;
+        if((plan->sub = fft_plan_create_r(ctx, n, FFT_ALG_DIT)) == NULL) {
+            fft_plan_destroy(plan);
+            return NULL;
+        }
+    }
+
+    plan->length    = length;
+    plan->algorithm = algorithm;
+    plan->sixstep   = FFT_SIXSTEP_AUTO;
+
+    // SIMD level of the butterflies, found once so that executing
+    // the plan changes no shared state
+#ifdef FFT_X86
+    plan->simd = cpu_simd();
 #else
-        W1N.r = cos((2 * M_PI)/n);
-        W1N.i = cos((2 * M_PI)/n - M_PI_2); // -sin(2pi/n)
+    plan->simd = FFT_SIMD_NONE;
 #endif
 
-        // Loop for each power k between 0 and (n/2 - 1)
-        for(k = 0; k < ndiv2; k++) {
-            //                           k
-            // For each butterfly using W  
-            //                           n
-            for(idx = k; idx < length; idx += n) {
+    // Calculate the bit reversed value of each index, as limited
+    // by the bit width for the given length
+    a = 0;
+    for(idx = 0; idx < length; idx++) {
+        plan->bitrev[idx] = a;
 
-                // Index across the DFT
-                idx2 = idx + ndiv2;
-                
-                // Butterfly calculation
+        b = length >> 1;
+        while(b && b <= a) {
+            a -= b;
+            b >>= 1;
+        }
+        a += b;
+    }
 
-                // x[idx2] = x[idx] - x[idx2] * Wkn
-                MULTC(tmp, x[idx2], WkN);
-                SUBC(x[idx2], x[idx], tmp);
+    // Twiddle factors for the final (length point) stage, where
+    // W(k, n) = cos(2 Pi k/n) - j sin(2 Pi k/n)
+    W = plan->twiddle + (length >> 1) - 1;
+#ifdef COS_TABLE
+    cos_table_create();
+    table_twiddles(W, length);
+#else
+    for(k = 0; k < (length >> 1); k++) {
+        W[k].r = cos(((2 * M_PI) * k)/length);
+        W[k].i = cos(((2 * M_PI) * k)/length - M_PI_2); // -sin(2pi k/n)
+    }
+#endif
 
-                // x[idx]  = x[idx] + x[idx2] * Wkn
-                ADDC(x[idx], x[idx], tmp);
+    // Smaller stages use every (length/n)th factor of the final stage
+    for(n = 2; n < length; n <<= 1) {
+        ndiv2 = n >> 1;
+        for(k = 0; k < ndiv2; k++)
+            plan->twiddle[ndiv2 - 1 + k] = W[k * (length/n)];
+    }
+
+    // Radix-4 stage twiddle factors, W(k, n), W(2k, n) and W(3k, n),
+    // for k between 0 and (n/4 - 1). W(j, length) for j beyond
+    // length/2 is -W(j - length/2, length).
+    for(n = 4; n <= length; n <<= 1) {
+        W4 = plan->twiddle4 + 3 * ((n >> 2) - 1);
+        for(k = 0; k < (n >> 2); k++)
+            for(m = 1; m <= 3; m++) {
+                j = m * k * (length/n);
+                if(j < (length >> 1))
+                    W4[3*k + m-1] = W[j];
+                else {
+                    W4[3*k + m-1].r = -W[j - (length >> 1)].r;
+                    W4[3*k + m-1].i = -W[j - (length >> 1)].i;
+                }
             }
+    }
 
-            //  k+1    k    1
-            // W    = W  * W
-            //  n      n    n     
-            tmp = WkN;
-            MULTC(WkN, tmp, W1N);
-        }
+    return plan;
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_destroy()
+// -------------------------------------------------------------------------
+
+void fft_plan_destroy (fft_plan_t *plan)
+{
+    if(plan != NULL) {
+        free(plan->bitrev);
+        free(plan->twiddle);
+        free(plan->twiddle4);
+        free(plan->twiddle4_re);
+        free(plan->twiddle4_im);
+        free(plan->twiddle4f_re);
+        free(plan->twiddle4f_im);
+        free(plan->work);
+        fft_plan_destroy(plan->sub);
+        free(plan);
+    }
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute()
+// -------------------------------------------------------------------------
+
+int fft_plan_execute (const fft_plan_t *plan, complex_t x[], const int inverse)
+{
+    return fft_plan_execute_pruned_r(NULL, plan, x, plan->length, inverse);
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute_pruned()
+//
+// Transform where only the first 'nonzero' points of x[] are
+// non-zero. The remaining points are not read, and are taken
+// to be zero.
+// -------------------------------------------------------------------------
+
+int fft_plan_execute_pruned (const fft_plan_t *plan, complex_t x[], const int nonzero, const int inverse)
+{
+    return fft_plan_execute_pruned_r(&fft_global_ctx, plan, x, nonzero, inverse);
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute_pruned_r()
+// -------------------------------------------------------------------------
+
+int fft_plan_execute_pruned_r (fft_ctx_t *ctx, const fft_plan_t *plan, complex_t x[],
+                               const int nonzero, const int inverse)
+{
+    int n;
+    // Length of the transform
+    int length = plan->length;
+
+    if(nonzero < 1 || nonzero > length) {
+        fft_error(ctx, "fft(): Error! non-zero point count (%d) out of range for length %d", nonzero, length);
+        return FFT_ERRORSTATUS;
     }
 
+    // If inverse (synthesis) transform, pre-adjust values (conjugate)
+    if(inverse)
+        for(n = 0; n < nonzero ; n++) 
+            x[n].i *= -1.0;
+
+    // Do the transform over the whole plan length
+    fft_stages(ctx, plan, x, length, nonzero);
+
     // If inverse (synthesis) transform, post-adjust values (conjugate)
     if(inverse) 
         for(n = 0; n < length ; n++) 
@@ -226,99 +685,1671 @@ int fft (complex_t x[], const int length, const int inverse)
 }  
 
 // -------------------------------------------------------------------------
-// Digital fourier transform
+// fft_real()
 //
-// Calculates the DFT of the data in array[], of 'length'
-// points. An inverse transform is done if 'inverse' is true.
-// Transformed data is returned in array[].
+// Forward transform of 'length' real points in in[], using
+// a plan kept in the same way as for fft(). Results placed
+// in out[].
 // -------------------------------------------------------------------------
 
-int dft(complex_t array[], const int length, const int inverse)
+int fft_real (const real_t in[], complex_t out[], const int length)
 {
-    int n, i, j;
-    double wk, real_s, imag_s ;
-    complex_t *x;
-
-    // Clear error message
-    msgbuf[0] = '\0';
+    return fft_real_r(&fft_global_ctx, in, out, length);
+}
 
-    // Must have at least 2 points to do a DFT
-    if(length < 2) {
-        sprintf(msgbuf, "dft(): Error! requested DFT length (%d) is less than minimum of 2", length);
-        return FFT_ERRORSTATUS;
-    }
+// -------------------------------------------------------------------------
+// fft_real_r()
+// -------------------------------------------------------------------------
 
-    // Obtain some memory for the transform.
-    if((x = malloc(length * sizeof(complex_t))) == NULL) {
-        sprintf(msgbuf, "dft(): Error! unable to allocate memory");
+int fft_real_r (fft_ctx_t *ctx, const real_t in[], complex_t out[], const int length)
+{
+    if(last_plan(ctx, length) == NULL)
         return FFT_ERRORSTATUS;
-    }
 
-    // Copy input data locally and clear input for accumulation of results
-    for(i=0; i < length; i++) {
-        x[i] = array[i];
-        array[i].r = array[i].i = 0;
-    }
+    return fft_plan_execute_real_pruned_r(ctx, ctx->plan, in, out, length);
+}
 
-    // If inverse (synthesis) transform, pre-adjust values (conjugate)
-    if(inverse)
-        for(n = 0; n < length ; n++) 
-            x[n].i /= -1.0;
+// -------------------------------------------------------------------------
+// fft_real_pruned()
+//
+// As fft_real(), but with only the first 'nonzero' points of
+// in[] non-zero.
+// -------------------------------------------------------------------------
 
-    // DFT loops
-    for(i=0; i < length; i++) {
-        for(j=0; j < length; j++) {
-            wk = (2 * M_PI) * ((double)(i*j) / (double)length);
-            real_s = cos(wk);
-            imag_s = -1 * sin(wk);
+int fft_real_pruned (const real_t in[], complex_t out[], const int length, const int nonzero)
+{
+    return fft_real_pruned_r(&fft_global_ctx, in, out, length, nonzero);
+}
 
-            array[i].r += x[j].r * real_s - x[j].i * imag_s;
-            array[i].i += x[j].r * imag_s + x[j].i * real_s;
-        }
-    }
+// -------------------------------------------------------------------------
+// fft_real_pruned_r()
+// -------------------------------------------------------------------------
 
-    // If inverse (synthesis) transform, post-adjust values (conjugate)
-    if(inverse)  {
-        for(n = 0; n < length ; n++) {
-            array[n].i /= -1.0 * length;
-            array[n].r /= length;
-        }
-    }
+int fft_real_pruned_r (fft_ctx_t *ctx, const real_t in[], complex_t out[], const int length, const int nonzero)
+{
+    if(last_plan(ctx, length) == NULL)
+        return FFT_ERRORSTATUS;
 
-    return FFT_OKSTATUS;
+    return fft_plan_execute_real_pruned_r(ctx, ctx->plan, in, out, nonzero);
 }
 
 // -------------------------------------------------------------------------
-// Bit reversal adapted from "The Scientist & Engineer's Guide
-// to Digital Signal Processing", 2nd Ed., Steven W. Smith, 
-// 1999
+// fft_real_pruned_f()
+//
+// As fft_real_pruned(), but transformed as single precision
+// split data, the results being converted back to out[].
 // -------------------------------------------------------------------------
 
-static void bitrev(complex_t x[], const int n)
+int fft_real_pruned_f (const real_t in[], complex_t out[], const int length, const int nonzero)
 {
-    int idx, a, b, ndiv2, nsub1;
-    complex_t tmp;
-
-    a = 0;
-    ndiv2 = n/2;
-    nsub1 = n-1;
-    // For the entire array ...
-    for (idx = 0; idx < nsub1; idx++) {
-        // Swap elements if index is < bit reversed index (could use
-        // 'greater than'---either would do; just don't swap twice)
-        if(idx < a) {
-            tmp = x[a];
-            x[a] = x[idx];
-            x[idx] = tmp;
-        }
-        // Calculate next n, which is bit reversed value of idx,
-        // as limited by bit width for given length
-        b = ndiv2;
-        while(b <= a) {
-            a -= b;
-            b >>= 1;
-        }
-        a += b;
-    }
+    return fft_real_pruned_f_r(&fft_global_ctx, in, out, length, nonzero);
 }
 
+// -------------------------------------------------------------------------
+// fft_real_pruned_f_r()
+// -------------------------------------------------------------------------
+
+int fft_real_pruned_f_r (fft_ctx_t *ctx, const real_t in[], complex_t out[], const int length, const int nonzero)
+{
+    split_complex_f_t s;
+    int status;
+
+    if(last_plan(ctx, length) == NULL)
+        return FFT_ERRORSTATUS;
+
+    if(nonzero < 1 || nonzero > length) {
+        fft_error(ctx, "fft(): Error! non-zero point count (%d) out of range for length %d", nonzero, length);
+        return FFT_ERRORSTATUS;
+    }
+
+    if(split_alloc_f(&s, length) != FFT_OKSTATUS) {
+        fft_error(ctx, "fft(): Error! unable to allocate memory");
+        return FFT_ERRORSTATUS;
+    }
+
+    // With the arguments checked, a failure can only be in making the
+    // plan's single precision twiddle factors
+    if((status = fft_plan_execute_real_split_f(ctx->plan, in, &s, nonzero)) == FFT_OKSTATUS)
+        split_to_complex_f(&s, out);
+    else
+        fft_error(ctx, "fft(): Error! unable to allocate memory");
+
+    split_free_f(&s);
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute_real()
+//
+// The real data is packed as length/2 complex points, with
+// even samples in the real part and odd samples in the
+// imaginary part, and given a half length transform, Z. The
+// even and odd sample spectra are then split out:
+//
+//   E(k) = (Z(k) + Z*(N/2-k))/2,  O(k) = -j(Z(k) - Z*(N/2-k))/2
+//
+// and combined as X(k) = E(k) + W(k, N) O(k). Only the first
+// half needs calculating, as X(N-k) = X*(k) for real data.
+// -------------------------------------------------------------------------
+
+int fft_plan_execute_real (const fft_plan_t *plan, const real_t in[], complex_t out[])
+{
+    return fft_plan_execute_real_pruned_r(NULL, plan, in, out, plan->length);
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute_real_pruned()
+//
+// Real transform where only the first 'nonzero' points of
+// in[] are non-zero. The remaining points are not read.
+// -------------------------------------------------------------------------
+
+int fft_plan_execute_real_pruned (const fft_plan_t *plan, const real_t in[], complex_t out[], const int nonzero)
+{
+    return fft_plan_execute_real_pruned_r(&fft_global_ctx, plan, in, out, nonzero);
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute_real_pruned_r()
+// -------------------------------------------------------------------------
+
+int fft_plan_execute_real_pruned_r (fft_ctx_t *ctx, const fft_plan_t *plan, const real_t in[],
+                                    complex_t out[], const int nonzero)
+{
+    int k, n;
+    // Length of the transform, and of the packed complex data
+    int length = plan->length, ndiv2 = plan->length >> 1;
+    // Twiddle factors for the full length stage
+    const complex_t *W = plan->twiddle + ndiv2 - 1;
+    // Number of non-zero packed points
+    int packed = (nonzero + 1) >> 1;
+    complex_t a, b, E, O, tmp;
+
+    if(nonzero < 1 || nonzero > length) {
+        fft_error(ctx, "fft(): Error! non-zero point count (%d) out of range for length %d", nonzero, length);
+        return FFT_ERRORSTATUS;
+    }
+
+    // Pack the real data into the first half of out[]
+    for(n = 0; n < packed; n++) {
+        out[n].r = in[2*n];
+        out[n].i = (2*n + 1 < nonzero) ? in[2*n + 1] : 0.0;
+    }
+
+    // Half length complex transform
+    fft_stages(ctx, plan, out, ndiv2, packed);
+
+    // Split the DC and Nyquist points, which are purely real
+    tmp = out[0];
+    out[0].r     = tmp.r + tmp.i;   out[0].i     = 0.0;
+    out[ndiv2].r = tmp.r - tmp.i;   out[ndiv2].i = 0.0;
+
+    // Split the remaining points, pairing k with N/2-k so the
+    // calculation can be done in place. X(N/2-k) = (E(k) - W(k, N) O(k))*
+    for(k = 1; k <= (ndiv2 >> 1); k++) {
+        a   = out[k];
+        b.r = out[ndiv2 - k].r;
+        b.i = -out[ndiv2 - k].i;
+
+        E.r = 0.5 * (a.r + b.r);
+        E.i = 0.5 * (a.i + b.i);
+        O.r = 0.5 * (a.i - b.i);
+        O.i = 0.5 * (b.r - a.r);
+
+        MULTC(tmp, W[k], O);
+        ADDC(out[k], E, tmp);
+
+        SUBC(out[ndiv2 - k], E, tmp);
+        out[ndiv2 - k].i *= -1.0;
+    }
+
+    // Fill in the upper half from the complex conjugate of the lower half
+    for(k = 1; k < ndiv2; k++) {
+        out[length - k].r =  out[k].r;
+        out[length - k].i = -out[k].i;
+    }
+
+    // Normalise, as for a forward complex transform
+    for(n = 0; n < length ; n++) {
+        out[n].i /= length;
+        out[n].r /= length;
+    }
+
+    // Return with good status
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// fft_batch()
+//
+// Transforms 'count' arrays of 'length' points, one after
+// another in bufs[], using a plan kept in the same way as
+// for fft().
+// -------------------------------------------------------------------------
+
+int fft_batch (complex_t bufs[], const int length, const int count, const int inverse)
+{
+    return fft_batch_r(&fft_global_ctx, bufs, length, count, inverse);
+}
+
+// -------------------------------------------------------------------------
+// fft_batch_r()
+// -------------------------------------------------------------------------
+
+int fft_batch_r (fft_ctx_t *ctx, complex_t bufs[], const int length, const int count, const int inverse)
+{
+    if(last_plan(ctx, length) == NULL)
+        return FFT_ERRORSTATUS;
+
+    return fft_plan_execute_batch_r(ctx, ctx->plan, bufs, count, inverse);
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute_batch()
+//
+// As fft_plan_execute() for 'count' arrays of the plan's
+// length, one after another in bufs[]. The arrays are done
+// BATCH_LANES at a time, with their points interleaved as
+// split real and imaginary data (point n of array b at
+// n * BATCH_LANES + b). Every butterfly then works on the
+// same point of each array, with the same twiddle factor,
+// so each twiddle factor is loaded once for all of them,
+// and the loops over the arrays fill the vector lanes. The
+// bit reversal is done as the arrays are interleaved, and
+// the normalisation as they are copied back. A final group
+// of fewer than BATCH_LANES arrays is padded with zeros.
+// -------------------------------------------------------------------------
+
+int fft_plan_execute_batch (const fft_plan_t *plan, complex_t bufs[], const int count, const int inverse)
+{
+    return fft_plan_execute_batch_r(&fft_global_ctx, plan, bufs, count, inverse);
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute_batch_r()
+// -------------------------------------------------------------------------
+
+int fft_plan_execute_batch_r (fft_ctx_t *ctx, const fft_plan_t *plan, complex_t bufs[],
+                              const int count, const int inverse)
+{
+    int n, a, b, lanes, first;
+    int length = plan->length;
+    real_t *re, *im, sign = inverse ? -1.0 : 1.0;
+    complex_t *x;
+
+    if(count < 0) {
+        fft_error(ctx, "fft(): Error! batch count (%d) is negative", count);
+        return FFT_ERRORSTATUS;
+    }
+
+    if((re = malloc(2 * BATCH_LANES * length * sizeof(real_t))) == NULL) {
+        fft_error(ctx, "fft(): Error! unable to allocate memory");
+        return FFT_ERRORSTATUS;
+    }
+    im = re + BATCH_LANES * length;
+
+    for(first = 0; first < count; first += BATCH_LANES) {
+        lanes = (count - first < BATCH_LANES) ? count - first : BATCH_LANES;
+
+        x = bufs + first * length;
+
+        // Zero the unused lanes of a final part group
+        if(lanes < BATCH_LANES)
+            for(n = 0; n < length * BATCH_LANES; n++)
+                re[n] = im[n] = 0.0;
+
+        // Interleave the arrays in bit reversed order, conjugating
+        // for an inverse transform
+        for(n = 0; n < length; n++) {
+            a = plan->bitrev[n] * BATCH_LANES;
+            for(b = 0; b < lanes; b++) {
+                re[a + b] = x[b * length + n].r;
+                im[a + b] = x[b * length + n].i * sign;
+            }
+        }
+
+#ifdef FFT_X86
+        if(plan_simd(plan) == FFT_SIMD_AVX2)
+            batch_stages_avx2(plan, re, im);
+        else
+#endif
+            batch_stages(plan, re, im);
+
+        // Copy back, conjugating for an inverse transform, or
+        // normalising for a forward one
+        for(n = 0; n < length; n++)
+            for(b = 0; b < lanes; b++)
+                if(inverse) {
+                    x[b * length + n].r =  re[n * BATCH_LANES + b];
+                    x[b * length + n].i = -im[n * BATCH_LANES + b];
+                } else {
+                    x[b * length + n].r = re[n * BATCH_LANES + b] / length;
+                    x[b * length + n].i = im[n * BATCH_LANES + b] / length;
+                }
+    }
+
+    free(re);
+
+    // Return with good status
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// batch_stages()
+//
+// The stages of fft_stages(), less the bit reversal and
+// pruning, for BATCH_LANES interleaved arrays of the plan's
+// length, with an inner loop over the arrays for each
+// butterfly. The radix-4 butterflies are as radix4_scalar().
+// -------------------------------------------------------------------------
+
+static FORCE_INLINE void batch_stages (const fft_plan_t *plan, real_t * RESTRICT re, real_t * RESTRICT im)
+{
+    int length = plan->length, stages, n, m, k, b, idx, idx2;
+    int i0, i1, i2, i3;
+    real_t tr, ti, Ar, Ai, Br, Bi, Cr, Ci, Dr, Di;
+    complex_t W1, W2, W3;
+    const complex_t *W;
+
+    for(stages = 0, n = 1; n < length; n <<= 1)
+        stages++;
+
+    // Single radix-2 stage for an odd number of stages, with n = 2
+    // and W(0, 2) = 1
+    if(stages & 1)
+        for(idx = 0; idx < length * BATCH_LANES; idx += 2 * BATCH_LANES)
+            for(b = idx; b < idx + BATCH_LANES; b++) {
+                tr = re[b + BATCH_LANES];
+                ti = im[b + BATCH_LANES];
+                re[b + BATCH_LANES] = re[b] - tr;
+                im[b + BATCH_LANES] = im[b] - ti;
+                re[b] += tr;
+                im[b] += ti;
+            }
+
+    // Radix-4 stages, with W(k, n), W(2k, n), W(3k, n) for each k
+    for(n = (stages & 1) ? 8 : 4; n <= length; n <<= 2) {
+        m = n >> 2;
+        W = plan->twiddle4 + 3 * (m - 1);
+
+        for(idx2 = 0; idx2 < length; idx2 += n)
+            for(k = 0; k < m; k++) {
+                i0 = (idx2 + k) * BATCH_LANES;
+                i1 = i0 +     m * BATCH_LANES;
+                i2 = i0 + 2 * m * BATCH_LANES;
+                i3 = i0 + 3 * m * BATCH_LANES;
+                W1 = W[3*k];
+                W2 = W[3*k + 1];
+                W3 = W[3*k + 2];
+
+                // The four points' lanes never overlap
+                IVDEP
+                for(b = 0; b < BATCH_LANES; b++) {
+                    Ar = re[i0 + b];
+                    Ai = im[i0 + b];
+                    Br = re[i2 + b] * W1.r - im[i2 + b] * W1.i;
+                    Bi = im[i2 + b] * W1.r + re[i2 + b] * W1.i;
+                    Cr = re[i1 + b] * W2.r - im[i1 + b] * W2.i;
+                    Ci = im[i1 + b] * W2.r + re[i1 + b] * W2.i;
+                    Dr = re[i3 + b] * W3.r - im[i3 + b] * W3.i;
+                    Di = im[i3 + b] * W3.r + re[i3 + b] * W3.i;
+
+                    re[i0 + b] = (Ar + Cr) + (Br + Dr);
+                    im[i0 + b] = (Ai + Ci) + (Bi + Di);
+                    re[i2 + b] = (Ar + Cr) - (Br + Dr);
+                    im[i2 + b] = (Ai + Ci) - (Bi + Di);
+                    re[i1 + b] = (Ar - Cr) - (Bi - Di);
+                    im[i1 + b] = (Ai - Ci) + (Br - Dr);
+                    re[i3 + b] = (Ar - Cr) + (Bi - Di);
+                    im[i3 + b] = (Ai - Ci) - (Br - Dr);
+                }
+            }
+    }
+}
+
+#ifdef FFT_X86
+
+// -------------------------------------------------------------------------
+// batch_stages_avx2()
+//
+// batch_stages() compiled for AVX2/FMA, where the loops over
+// the BATCH_LANES arrays are a single vector.
+// -------------------------------------------------------------------------
+
+TARGET_AVX2
+static void batch_stages_avx2 (const fft_plan_t *plan, real_t * RESTRICT re, real_t * RESTRICT im)
+{
+    batch_stages(plan, re, im);
+}
+
+#endif
+
+// -------------------------------------------------------------------------
+// fft_stages()
+//
+// Transforms the first 'length' points of x[], where length
+// is a power of 2 no greater than the plan's length, with
+// the plan's algorithm: stockham(), six_step() for large
+// transforms, or else fft_stages_dit(). 'ctx' holds the six
+// step work buffer, as for six_step().
+// -------------------------------------------------------------------------
+
+static void fft_stages (fft_ctx_t *ctx, const fft_plan_t *plan, complex_t x[], const int length, const int nonzero)
+{
+    // Stockham plans have their own, self sorting, stages
+    if(plan->algorithm == FFT_ALG_STOCKHAM)
+        stockham(plan, x, length, nonzero);
+
+    // Large transforms, or those for multiple threads, are cache blocked,
+    // unless the plan says otherwise
+    else if(plan->sub != NULL && length >= SIXSTEP_MIN &&
+            (plan->sixstep != FFT_SIXSTEP_AUTO ? plan->sixstep :
+             (length >= sixstep_length || fft_set_threads(-1) > 1)))
+        six_step(ctx, plan, x, length, nonzero);
+
+    else
+        fft_stages_dit(plan, x, length, nonzero);
+}
+
+// -------------------------------------------------------------------------
+// fft_stages_dit()
+//
+// Bit reverses x[] and does the butterflies for each stage
+// of a 'length' point transform, in place.
+//
+// Only the first 'nonzero' points of x[] are used, the rest
+// being taken as zero. After the n point stage, each block
+// of n points is the DFT of every (length/n)th input, and
+// if there are no more than length/n non-zero inputs only
+// one of those is non-zero, so the DFT is that point
+// repeated. So, with K the power of 2 no smaller than
+// 'nonzero', the first K points are bit reversed (as a K
+// point array) and each copied over a block of length/K
+// points, and the stages up to length/K points skipped.
+// -------------------------------------------------------------------------
+
+static void fft_stages_dit (const fft_plan_t *plan, complex_t x[], const int length, const int nonzero)
+{
+    // Indexes for the two points of the array in the butterfly
+    int idx, idx2;    
+    // The current size of DFT being processed (and divided by 2)
+    int n, ndiv2;     
+    // The current power Wn is raised to, for butterfly calculation
+    int k;            
+    // Twiddle factors for the current stage
+    const complex_t *WkN;
+    // Temporary complex_t number holder
+    complex_t tmp;
+    // Number of points holding the non-zero inputs, and the
+    // size of the blocks each is copied over
+    int K, blocklen;
+    // Number of stages left after pruning
+    int stages;
+    // Radix-4 stage function for the plan's SIMD level
+    radix4_func_t radix4_stage;
+
+    switch(plan_simd(plan)) {
+#ifdef FFT_X86
+    case FFT_SIMD_AVX2: radix4_stage = radix4_avx2;   break;
+    case FFT_SIMD_SSE2: radix4_stage = radix4_sse2;   break;
+#endif
+    default:            radix4_stage = radix4_scalar; break;
+    }
+
+    for(K = 1; K < nonzero; K <<= 1)
+        ;
+    blocklen = length / K;
+
+    // Zero any points between the non-zero inputs and K
+    for(idx = nonzero; idx < K; idx++)
+        x[idx].r = x[idx].i = 0.0;
+
+    // Bit reverse the non-zero part of array x
+    bitrev(x, plan, K);
+
+    // Copy each point over its block, working down so that the
+    // points yet to be copied are not overwritten
+    if(blocklen > 1)
+        for(idx2 = K-1; idx2 >= 0; idx2--) {
+            tmp = x[idx2];
+            for(idx = 0; idx < blocklen; idx++)
+                x[idx2 * blocklen + idx] = tmp;
+        }
+
+    // If an odd number of stages remain, do a single radix-2 stage
+    // first, so the rest can be done as radix-4 stages
+    for(stages = 0, n = blocklen; n < length; n <<= 1)
+        stages++;
+
+    if(stages & 1) {
+        n = blocklen << 1;
+        ndiv2 = n>>1;    // n / 2
+
+        // Precomputed W(k, n) for k between 0 and (n/2 - 1)
+        WkN = plan->twiddle + ndiv2 - 1;
+
+        // For each n point DFT ...
+        for(idx2 = 0; idx2 < length; idx2 += n) {
+            //                                        k
+            // ... do the butterfly for each power of W
+            //                                        n
+            for(k = 0; k < ndiv2; k++) {
+
+                idx = idx2 + k;
+                
+                // Butterfly calculation
+
+                // x[idx+n/2] = x[idx] - x[idx+n/2] * Wkn
+                MULTC(tmp, x[idx + ndiv2], WkN[k]);
+                SUBC(x[idx + ndiv2], x[idx], tmp);
+
+                // x[idx]  = x[idx] + x[idx+n/2] * Wkn
+                ADDC(x[idx], x[idx], tmp);
+            }
+        }
+
+        blocklen = n;
+    }
+
+    // Loop for each remaining 'n' point DFT stage, in radix-4
+    for(n = blocklen << 2; n <= length; n <<= 2)
+        // Precomputed W(k, n), W(2k, n), W(3k, n) for k between 0 and (n/4 - 1)
+        (*radix4_stage)(x, plan->twiddle4 + 3 * ((n >> 2) - 1), length, n);
+}
+
+// -------------------------------------------------------------------------
+// six_step()
+//
+// Cache blocked transform of the first 'length' points of
+// x[], with length = N1 N2. Viewing x[] as N1 rows of N2
+// points, so n = n1 N2 + n2, and the results as k = k1 +
+// N1 k2:
+//
+//   X(k1 + N1 k2) = sum over n2 of W(n2 k2, N2) W(n2 k1, N)
+//                   (sum over n1 of W(n1 k1, N1) x(n1 N2 + n2))
+//
+// This is done in two passes over the data, each working on
+// SIXSTEP_TILE rows at a time, which stay in cache:
+//
+//   A: Columns n2 of x[] are copied to rows of a work
+//      buffer, y[], and given an N1 point transform,
+//      and multiplied by W(n2 k1, N)
+//   B: Columns k1 of y[] are copied to rows of a tile
+//      buffer, given an N2 point transform, and copied to
+//      x[] at k2 N1 + k1, in order
+//
+// So, rather than log2(length)/2 passes of the radix-4
+// stages, each point is read and written twice (64 bytes
+// per point), with the copies done by six_step_copy() over
+// SIXSTEP_TILE rows or columns at a time.
+// The row transforms use the plan's sub-plan. W(j, N) is
+// calculated as W(j / N2, N1) W(j % N2, N), from two small
+// tables. The tiles are shared between threads when
+// compiled with OpenMP.
+//
+// The work and tile buffers are kept in the caller's context,
+// grown as needed, rather than in the plan, so that threads
+// may share the plan, and a caller doing many transforms
+// allocates them once. For a NULL context, or fft_global_ctx
+// (whose wrappers may be given a plan shared by any caller),
+// they are allocated for each transform. If they cannot be
+// allocated, the ordinary stages are used instead.
+// -------------------------------------------------------------------------
+
+static void six_step (fft_ctx_t *ctx, const fft_plan_t *plan, complex_t x[], const int length, const int nonzero)
+{
+    int N1, N2, logN2, n, t, n1, n2, j, threads, points, owned;
+    // Work buffer for the columns of x[], and the tile buffers
+    complex_t *y, *tiles, *buf;
+    // W(j, N) and W(j, N1) for j between 0 and (N/2 - 1), and (N1/2 - 1)
+    const complex_t *Wlo = plan->twiddle + (length >> 1) - 1, *Whi;
+    complex_t w, whi, tmp;
+
+    // N2 is the larger, at the square root of length rounded up
+    for(N2 = 1, logN2 = 0; N2 * N2 < length; N2 <<= 1)
+        logN2++;
+    N1  = length / N2;
+    Whi = plan->twiddle + (N1 >> 1) - 1;
+
+    threads = fft_set_threads(-1);
+    points  = length + threads * SIXSTEP_TILE * N2;
+    owned   = (ctx == NULL || ctx == &fft_global_ctx);
+
+    if(!owned && ctx->scratch_len < points) {
+        free(ctx->scratch);
+        ctx->scratch_len = 0;
+        if((ctx->scratch = malloc(points * sizeof(complex_t))) != NULL)
+            ctx->scratch_len = points;
+    }
+
+    if((y = owned ? malloc(points * sizeof(complex_t)) : ctx->scratch) == NULL) {
+        fft_stages_dit(plan, x, length, nonzero);
+        return;
+    }
+    tiles = y + length;
+
+    // Zero any points from the non-zero inputs
+    for(n = nonzero; n < length; n++)
+        x[n].r = x[n].i = 0.0;
+
+#ifdef _OPENMP
+#pragma omp parallel num_threads(threads) private(buf, n, n1, n2, j, w, whi, tmp)
+#endif
+    {
+#ifdef _OPENMP
+        buf = tiles + omp_get_thread_num() * SIXSTEP_TILE * N2;
+#else
+        buf = tiles;
+#endif
+
+        // Pass A: N1 point transforms of the columns of x[], in rows of y[]
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for(t = 0; t < N2; t += SIXSTEP_TILE) {
+            six_step_copy(y + t * N1, N1, x + t, N2, N1, SIXSTEP_TILE);
+
+            for(n2 = t; n2 < t + SIXSTEP_TILE; n2++) {
+                fft_stages_dit(plan->sub, y + n2 * N1, N1, N1);
+
+                // Multiply by W(n2 k1, N), where W(j, N1) = -W(j - N1/2, N1)
+                // for j above N1/2
+                for(n1 = 1; n1 < N1; n1++) {
+                    j = n2 * n1;
+                    n = j >> logN2;
+                    if(n < (N1 >> 1))
+                        whi = Whi[n];
+                    else {
+                        whi.r = -Whi[n - (N1 >> 1)].r;
+                        whi.i = -Whi[n - (N1 >> 1)].i;
+                    }
+                    MULTC(w, whi, Wlo[j & (N2 - 1)]);
+                    MULTC(tmp, y[n2 * N1 + n1], w);
+                    y[n2 * N1 + n1] = tmp;
+                }
+            }
+        }
+
+        // Pass B: N2 point transforms of the columns of y[], put in order in x[]
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for(t = 0; t < N1; t += SIXSTEP_TILE) {
+            six_step_copy(buf, N2, y + t, N1, N2, SIXSTEP_TILE);
+
+            for(n1 = 0; n1 < SIXSTEP_TILE; n1++)
+                fft_stages_dit(plan->sub, buf + n1 * N2, N2, N2);
+
+            six_step_copy(x + t, N1, buf, N2, SIXSTEP_TILE, N2);
+        }
+    }
+
+    if(owned)
+        free(y);
+}
+
+// -------------------------------------------------------------------------
+// six_step_copy()
+//
+// Transposes a 'rows' by 'cols' block of src[] into dst[],
+// as dst[c * dstride + r] = src[r * sstride + c]. The rows
+// and columns are in multiples of 4, copied in 4 by 4
+// blocks so that every cache line read or written (of four
+// points) is used whole, whatever the strides. Otherwise
+// the power of 2 strides map the lines to the same cache
+// sets, and they are evicted before they are used up.
+// -------------------------------------------------------------------------
+
+static void six_step_copy (complex_t dst[], const int dstride, const complex_t src[], const int sstride,
+                           const int rows, const int cols)
+{
+    int r, c, i, k;
+
+    for(r = 0; r < rows; r += 4)
+        for(c = 0; c < cols; c += 4)
+            for(i = 0; i < 4; i++)
+                for(k = 0; k < 4; k++)
+                    dst[(c + i) * dstride + r + k] = src[(r + k) * sstride + c + i];
+}
+
+// -------------------------------------------------------------------------
+// fft_set_sixstep()
+//
+// Sets the smallest length transformed with six_step(), with
+// 0 for the default (SIXSTEP_DEFAULT) and -1 leaving it
+// unchanged. Lengths below SIXSTEP_MIN are raised to it.
+// Returns the length set.
+// -------------------------------------------------------------------------
+
+int fft_set_sixstep (const int length)
+{
+    if(length == 0)
+        sixstep_length = SIXSTEP_DEFAULT;
+    else if(length > 0)
+        sixstep_length = (length < SIXSTEP_MIN) ? SIXSTEP_MIN : length;
+
+    return sixstep_length;
+}
+
+// -------------------------------------------------------------------------
+// fft_set_threads()
+//
+// Sets the number of threads for the six step transform of
+// large (DIT) plans, with 0 for the OpenMP default and -1
+// leaving it unchanged. Returns the number of threads that
+// will be used, which is 1 if not compiled with OpenMP.
+// -------------------------------------------------------------------------
+
+int fft_set_threads (const int threads)
+{
+    if(threads >= 0)
+        fft_threads = threads;
+
+#ifdef _OPENMP
+    return fft_threads ? fft_threads : omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// stockham()
+//
+// Stockham autosort transform of the first 'length' points
+// of x[], as a decimation in frequency, ping-ponging between
+// x[] and the plan's work buffer so that the results come
+// out in natural order with no bit reversal pass. Each n
+// point stage (n = length, length/4, ...) at stride s does,
+// for p < n/4 and q < s, with a, b, c and d the points at
+// q + s(p + i n/4), i = 0 to 3, and W(n/4, n) = j:
+//
+//   y[q + s(4p)]   =         (a + c) +  (b + d)
+//   y[q + s(4p+1)] = W(p)  ((a - c) + j(b - d))
+//   y[q + s(4p+2)] = W(2p) ((a + c) -  (b + d))
+//   y[q + s(4p+3)] = W(3p) ((a - c) - j(b - d))
+//
+// with a final radix-2 stage for an odd number of stages.
+// Pruning is not used, but points from 'nonzero' are zeroed
+// so that they need not be on entry.
+// -------------------------------------------------------------------------
+
+static void stockham (const fft_plan_t *plan, complex_t x[], const int length, const int nonzero)
+{
+    int n, s, m, p, q, idx;
+    complex_t *in = x, *out = plan->work, *swap;
+    const complex_t *W;
+    complex_t a, b, c, d, apc, amc, bpd, bmd, tmp;
+
+    for(idx = nonzero; idx < length; idx++)
+        x[idx].r = x[idx].i = 0.0;
+
+    // Radix-4 stages
+    for(n = length, s = 1; n >= 4; n >>= 2, s <<= 2) {
+        m = n >> 2;
+        W = plan->twiddle4 + 3 * (m - 1);
+
+        for(p = 0; p < m; p++)
+            for(q = 0; q < s; q++) {
+                a = in[q + s*(p)];
+                b = in[q + s*(p + m)];
+                c = in[q + s*(p + 2*m)];
+                d = in[q + s*(p + 3*m)];
+
+                ADDC(apc, a, c);
+                SUBC(amc, a, c);
+                ADDC(bpd, b, d);
+                SUBC(bmd, b, d);
+
+                ADDC(out[q + s*(4*p)], apc, bpd);
+
+                tmp.r = amc.r - bmd.i;
+                tmp.i = amc.i + bmd.r;
+                MULTC(out[q + s*(4*p + 1)], tmp, W[3*p]);
+
+                SUBC(tmp, apc, bpd);
+                MULTC(out[q + s*(4*p + 2)], tmp, W[3*p + 1]);
+
+                tmp.r = amc.r + bmd.i;
+                tmp.i = amc.i - bmd.r;
+                MULTC(out[q + s*(4*p + 3)], tmp, W[3*p + 2]);
+            }
+
+        swap = in; in = out; out = swap;
+    }
+
+    // Final radix-2 stage, where W(0, 2) = 1
+    if(n == 2) {
+        for(q = 0; q < s; q++) {
+            a = in[q];
+            b = in[q + s];
+            ADDC(out[q],     a, b);
+            SUBC(out[q + s], a, b);
+        }
+
+        swap = in; in = out; out = swap;
+    }
+
+    // Copy the result back if it ended in the work buffer
+    if(in != x)
+        for(idx = 0; idx < length; idx++)
+            x[idx] = in[idx];
+}
+
+// -------------------------------------------------------------------------
+// radix4_scalar()
+//
+// Does an n point radix-4 stage over 'length' points of x[],
+// with W[] the stage's twiddle factors. With the points in
+// bit reversed order, the four n/4 point DFTs in each block
+// are of the inputs with indexes 0, 2, 1 and 3 mod 4.
+// -------------------------------------------------------------------------
+
+static void radix4_scalar (complex_t x[], const complex_t W[], const int length, const int n)
+{
+    int idx, idx2, k, ndiv4 = n >> 2;
+    complex_t A, B, C, D, AC0, AC1, BD0, BD1;
+
+    // For each n point DFT ...
+    for(idx2 = 0; idx2 < length; idx2 += n) {
+        // ... do the radix-4 butterfly for each k
+        for(k = 0; k < ndiv4; k++) {
+
+            idx = idx2 + k;
+
+            // A = F0(k), B = W(k) F1(k), C = W(2k) F2(k), D = W(3k) F3(k)
+            A = x[idx];
+            MULTC(B, x[idx + 2*ndiv4], W[3*k]);
+            MULTC(C, x[idx +   ndiv4], W[3*k + 1]);
+            MULTC(D, x[idx + 3*ndiv4], W[3*k + 2]);
+
+            ADDC(AC0, A, C);
+            SUBC(AC1, A, C);
+            ADDC(BD0, B, D);
+            SUBC(BD1, B, D);
+
+            // With W(n/4, n) = j, as for the twiddle factors generated
+            //
+            // x[idx]       = (A + C) +  (B + D)
+            // x[idx+n/4]   = (A - C) + j(B - D)
+            // x[idx+n/2]   = (A + C) -  (B + D)
+            // x[idx+3n/4]  = (A - C) - j(B - D)
+            ADDC(x[idx], AC0, BD0);
+            SUBC(x[idx + 2*ndiv4], AC0, BD0);
+
+            x[idx + ndiv4].r   = AC1.r - BD1.i;
+            x[idx + ndiv4].i   = AC1.i + BD1.r;
+            x[idx + 3*ndiv4].r = AC1.r + BD1.i;
+            x[idx + 3*ndiv4].i = AC1.i - BD1.r;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// fft_set_simd()
+//
+// Limits the SIMD level of the radix-4 stages, for every
+// plan, to 'level'. Returns the level the CPU will use,
+// being the lower of 'level' and what the CPU supports.
+// -------------------------------------------------------------------------
+
+int fft_set_simd (const int level)
+{
+    simd_limit = (level < FFT_SIMD_NONE) ? FFT_SIMD_NONE : level;
+
+#ifdef FFT_X86
+    return (simd_limit < cpu_simd()) ? simd_limit : cpu_simd();
+#else
+    return FFT_SIMD_NONE;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// plan_simd()
+//
+// Returns the SIMD level to use for a plan: the level its
+// CPU supports, as found when it was created (or as tuned),
+// limited by fft_set_simd().
+// -------------------------------------------------------------------------
+
+static int plan_simd (const fft_plan_t *plan)
+{
+    return (simd_limit < plan->simd) ? simd_limit : plan->simd;
+}
+
+#ifdef FFT_X86
+
+// -------------------------------------------------------------------------
+// cpu_simd()
+//
+// Returns the highest SIMD level supported by the CPU (and,
+// for AVX2, enabled by the OS), from the CPUID feature flags.
+// -------------------------------------------------------------------------
+
+static int cpu_simd (void)
+{
+    unsigned int regs1[4] = {0}, regs7[4] = {0}, xcr0 = 0;
+
+#if defined(_MSC_VER)
+    int info[4];
+
+    __cpuid(info, 0);
+    if(info[0] >= 1) {
+        __cpuid(info, 1);
+        regs1[0] = info[0]; regs1[1] = info[1]; regs1[2] = info[2]; regs1[3] = info[3];
+    }
+    if(info[0] >= 7) {
+        __cpuidex(info, 7, 0);
+        regs7[0] = info[0]; regs7[1] = info[1]; regs7[2] = info[2]; regs7[3] = info[3];
+    }
+    // OSXSAVE set, so XGETBV available
+    if(regs1[2] & (1 << 27))
+        xcr0 = (unsigned int)_xgetbv(0);
+#else
+    __get_cpuid(1, &regs1[0], &regs1[1], &regs1[2], &regs1[3]);
+    __get_cpuid_count(7, 0, &regs7[0], &regs7[1], &regs7[2], &regs7[3]);
+    // OSXSAVE set, so XGETBV available
+    if(regs1[2] & (1 << 27))
+        __asm__ ("xgetbv" : "=a" (xcr0) : "c" (0) : "edx");
+#endif
+
+    // AVX2 (CPUID 7 EBX bit 5) and FMA (CPUID 1 ECX bit 12), with
+    // the OS saving the SSE and AVX registers (XCR0 bits 1 and 2)
+    if((regs7[1] & (1 << 5)) && (regs1[2] & (1 << 12)) && (xcr0 & 6) == 6)
+        return FFT_SIMD_AVX2;
+
+    // SSE2 (CPUID 1 EDX bit 26)
+    if(regs1[3] & (1 << 26))
+        return FFT_SIMD_SSE2;
+
+    return FFT_SIMD_NONE;
+}
+
+// -------------------------------------------------------------------------
+// radix4_sse2()
+//
+// As radix4_scalar(), with a complex_t held in each 128 bit
+// register. A complex multiply is done as x * W.r + (swapped
+// x) * W.i, with the sign of the real part of the second
+// product negated, which matches MULTC() exactly.
+// -------------------------------------------------------------------------
+
+TARGET_SSE2
+static void radix4_sse2 (complex_t x[], const complex_t W[], const int length, const int n)
+{
+    int idx, idx2, k, ndiv4 = n >> 2;
+    __m128d A, B, C, D, AC0, AC1, BD0, BD1, w, t;
+    const __m128d negr = _mm_set_pd(1.0, -1.0);
+    double *p = (double *)x;
+
+// Complex multiply of _X by twiddle _W, into _R
+#define MULTC_SSE2(_R, _X, _W) {                                                        \
+    w   = _mm_loadu_pd((const double *)&(_W));                                         \
+    t   = _mm_mul_pd(_mm_shuffle_pd(_X, _X, 1), _mm_unpackhi_pd(w, w));               \
+    _R  = _mm_add_pd(_mm_mul_pd(_X, _mm_unpacklo_pd(w, w)), _mm_mul_pd(t, negr));     \
+}
+
+    for(idx2 = 0; idx2 < length; idx2 += n) {
+        for(k = 0; k < ndiv4; k++) {
+
+            idx = idx2 + k;
+
+            A = _mm_loadu_pd(p + 2*idx);
+            B = _mm_loadu_pd(p + 2*(idx + 2*ndiv4));
+            C = _mm_loadu_pd(p + 2*(idx +   ndiv4));
+            D = _mm_loadu_pd(p + 2*(idx + 3*ndiv4));
+
+            MULTC_SSE2(B, B, W[3*k]);
+            MULTC_SSE2(C, C, W[3*k + 1]);
+            MULTC_SSE2(D, D, W[3*k + 2]);
+
+            AC0 = _mm_add_pd(A, C);
+            AC1 = _mm_sub_pd(A, C);
+            BD0 = _mm_add_pd(B, D);
+            BD1 = _mm_sub_pd(B, D);
+
+            // j(B - D) = (-BD1.i, BD1.r)
+            BD1 = _mm_mul_pd(_mm_shuffle_pd(BD1, BD1, 1), negr);
+
+            _mm_storeu_pd(p + 2*idx,               _mm_add_pd(AC0, BD0));
+            _mm_storeu_pd(p + 2*(idx + 2*ndiv4),   _mm_sub_pd(AC0, BD0));
+            _mm_storeu_pd(p + 2*(idx +   ndiv4),   _mm_add_pd(AC1, BD1));
+            _mm_storeu_pd(p + 2*(idx + 3*ndiv4),   _mm_sub_pd(AC1, BD1));
+        }
+    }
+
+#undef MULTC_SSE2
+}
+
+// -------------------------------------------------------------------------
+// radix4_avx2()
+//
+// As radix4_scalar(), with two complex_t values, for k and
+// k+1, held in each 256 bit register. Stages with n/4 less
+// than 2 are done with the SSE2 function.
+// -------------------------------------------------------------------------
+
+TARGET_AVX2
+static void radix4_avx2 (complex_t x[], const complex_t W[], const int length, const int n)
+{
+    int idx, idx2, k, ndiv4 = n >> 2;
+    __m256d A, B, C, D, AC0, AC1, BD0, BD1, w;
+    const __m256d negr = _mm256_set_pd(1.0, -1.0, 1.0, -1.0);
+    double *p = (double *)x;
+
+    if(ndiv4 < 2) {
+        radix4_sse2(x, W, length, n);
+        return;
+    }
+
+// Complex multiply of _X by twiddles _W0 (low) and _W1 (high), into _R
+#define MULTC_AVX2(_R, _X, _W0, _W1) {                                                  \
+    w  = _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd((const double *)&(_W0))), \
+                              _mm_loadu_pd((const double *)&(_W1)), 1);                 \
+    _R = _mm256_fmaddsub_pd(_X, _mm256_movedup_pd(w),                                   \
+                            _mm256_mul_pd(_mm256_permute_pd(_X, 5),                     \
+                                          _mm256_permute_pd(w, 15)));                   \
+}
+
+    for(idx2 = 0; idx2 < length; idx2 += n) {
+        // n/4 is a power of 2 no less than 2, so k and k+1 are always in range
+        for(k = 0; k < ndiv4; k += 2) {
+
+            idx = idx2 + k;
+
+            A = _mm256_loadu_pd(p + 2*idx);
+            B = _mm256_loadu_pd(p + 2*(idx + 2*ndiv4));
+            C = _mm256_loadu_pd(p + 2*(idx +   ndiv4));
+            D = _mm256_loadu_pd(p + 2*(idx + 3*ndiv4));
+
+            MULTC_AVX2(B, B, W[3*k],     W[3*k + 3]);
+            MULTC_AVX2(C, C, W[3*k + 1], W[3*k + 4]);
+            MULTC_AVX2(D, D, W[3*k + 2], W[3*k + 5]);
+
+            AC0 = _mm256_add_pd(A, C);
+            AC1 = _mm256_sub_pd(A, C);
+            BD0 = _mm256_add_pd(B, D);
+            BD1 = _mm256_sub_pd(B, D);
+
+            // j(B - D) = (-BD1.i, BD1.r)
+            BD1 = _mm256_mul_pd(_mm256_permute_pd(BD1, 5), negr);
+
+            _mm256_storeu_pd(p + 2*idx,             _mm256_add_pd(AC0, BD0));
+            _mm256_storeu_pd(p + 2*(idx + 2*ndiv4), _mm256_sub_pd(AC0, BD0));
+            _mm256_storeu_pd(p + 2*(idx +   ndiv4), _mm256_add_pd(AC1, BD1));
+            _mm256_storeu_pd(p + 2*(idx + 3*ndiv4), _mm256_sub_pd(AC1, BD1));
+        }
+    }
+
+#undef MULTC_AVX2
+}
+
+#endif
+
+// -------------------------------------------------------------------------
+// Digital fourier transform
+//
+// Calculates the DFT of the data in array[], of 'length'
+// points. An inverse transform is done if 'inverse' is true.
+// Transformed data is returned in array[].
+//
+// Lengths whose only prime factors are 2, 3, 5 and 7 use a
+// mixed radix transform. Any other length uses Bluestein's
+// algorithm. Both are O(N log N).
+// -------------------------------------------------------------------------
+
+int dft(complex_t array[], const int length, const int inverse)
+{
+    return dft_r(&fft_global_ctx, array, length, inverse);
+}
+
+// -------------------------------------------------------------------------
+// dft_r()
+//
+// Reentrant dft(), setting any error message in the caller's
+// context. The context's plan is not used.
+// -------------------------------------------------------------------------
+
+int dft_r(fft_ctx_t *ctx, complex_t array[], const int length, const int inverse)
+{
+    int factors[MAXFACTORS];
+
+    // Clear error message
+    if(ctx != NULL)
+        ctx->msg[0] = '\0';
+
+    // Must have at least 2 points to do a DFT
+    if(length < 2) {
+        fft_error(ctx, "dft(): Error! requested DFT length (%d) is less than minimum of 2", length);
+        return FFT_ERRORSTATUS;
+    }
+
+    if(factorise(length, factors))
+        return mixed_radix(ctx, array, length, factors, inverse);
+    else
+        return bluestein(ctx, array, length, inverse);
+}
+
+// -------------------------------------------------------------------------
+// factorise()
+//
+// Splits 'length' into factors of 4, 2, 3, 5 and 7 (radix 4
+// first, as fewest passes), terminated with a 0. Returns
+// FALSE if 'length' has any other prime factor.
+// -------------------------------------------------------------------------
+
+static int factorise (const int length, int factors[])
+{
+    static const int radices[] = {4, 2, 3, 5, 7};
+    int n = length, r, idx = 0;
+
+    for(r = 0; r < (int)(sizeof(radices)/sizeof(radices[0])); r++)
+        while(n % radices[r] == 0) {
+            factors[idx++] = radices[r];
+            n /= radices[r];
+        }
+
+    factors[idx] = 0;
+
+    return n == 1;
+}
+
+// -------------------------------------------------------------------------
+// mixed_radix()
+//
+// Transforms array[] with a recursive decimation in time,
+// splitting an N = p m point DFT into p DFTs of m points,
+// of every pth input, for each factor p in turn. The results
+// are calculated into a scratch buffer and copied back.
+// -------------------------------------------------------------------------
+
+static int mixed_radix (fft_ctx_t *ctx, complex_t array[], const int length, const int factors[], const int inverse)
+{
+    int n;
+    double wk;
+    complex_t *out, *W;
+
+    // Obtain some memory for the transform.
+    out = malloc(length * sizeof(complex_t));
+    W   = malloc(length * sizeof(complex_t));
+    if(out == NULL || W == NULL) {
+        free(out); free(W);
+        fft_error(ctx, "dft(): Error! unable to allocate memory");
+        return FFT_ERRORSTATUS;
+    }
+
+    // W(n, N) = exp(-j 2 Pi n/N), or its conjugate for an inverse
+    // (synthesis) transform
+    for(n = 0; n < length; n++) {
+        wk = ((2 * M_PI) * n) / length;
+        W[n].r = cos(wk);
+        W[n].i = (inverse ? 1.0 : -1.0) * sin(wk);
+    }
+
+    mixed_radix_pass(out, array, 1, factors, W, length);
+
+    // Copy back, normalising an inverse transform
+    for(n = 0; n < length; n++) {
+        array[n] = out[n];
+        if(inverse) {
+            array[n].r /= length;
+            array[n].i /= length;
+        }
+    }
+
+    free(out); free(W);
+
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// mixed_radix_pass()
+//
+// Places in out[] the DFT of the points of in[] at the
+// given stride, the number of points being the product of
+// factors[]. With p the first factor and m the remaining
+// product, the p sub-DFTs of m points are calculated into
+// consecutive blocks of out[], and then combined as:
+//
+//   X(k + u m) = SUM[q] W(q k, N) F_q(k) W(q u, p)
+//
+// where F_q is the qth sub-DFT. All twiddles are taken from
+// W[], holding W(n, length) for the full length, since
+// W(i, N) = W(i length/N, length) = W(i stride, length).
+// -------------------------------------------------------------------------
+
+static void mixed_radix_pass (complex_t out[], const complex_t in[], const int stride,
+                              const int factors[], const complex_t W[], const int length)
+{
+    int p = factors[0], m = length / (stride * p);
+    int k, q, u, tw;
+    complex_t scratch[MAXRADIX], sum, tmp;
+
+    // Last factor, so the sub-DFTs are single points
+    if(m == 1) {
+        for(q = 0; q < p; q++)
+            out[q] = in[q * stride];
+    } else
+        // Sub-DFT of every pth point, starting at each q
+        for(q = 0; q < p; q++)
+            mixed_radix_pass(out + q*m, in + q*stride, stride * p, factors + 1, W, length);
+
+    // Butterflies, combining the p sub-DFTs for each k
+    for(k = 0; k < m; k++) {
+
+        // Sub-DFT outputs with their twiddle W(q k, N)
+        scratch[0] = out[k];
+        for(q = 1; q < p; q++)
+            MULTC(scratch[q], out[k + q*m], W[(q * k * stride) % length]);
+
+        // p point DFT of the twiddled values
+        for(u = 0; u < p; u++) {
+            sum = scratch[0];
+            for(q = 1; q < p; q++) {
+                // W(q u, p) = W(q u m stride, length)
+                tw = (q * u * m * stride) % length;
+                MULTC(tmp, scratch[q], W[tw]);
+                ADDC(sum, sum, tmp);
+            }
+            out[k + u*m] = sum;
+        }
+    }
+}
+
+// -------------------------------------------------------------------------
+// bluestein()
+//
+// Transforms any length in O(N log N) using Bluestein's
+// algorithm. As nk = (n^2 + k^2 - (k-n)^2)/2, then with the
+// chirp c(n) = exp(j Pi n^2/N):
+//
+//   X(k) = c*(k) SUM[n] (x(n) c*(n)) c(k-n)
+//
+// which is a convolution, done as a circular convolution
+// with fft() over M points, a power of 2 no less than 2N-1.
+// -------------------------------------------------------------------------
+
+static int bluestein (fft_ctx_t *ctx, complex_t array[], const int length, const int inverse)
+{
+    int n, M;
+    double wk;
+    complex_t *a, *b, *c, tmp;
+    fft_plan_t *plan;
+
+    // Convolution length, avoiding circular wrap of the result
+    for(M = 2; M < 2*length - 1; M <<= 1)
+        ;
+
+    // Obtain some memory for the transform.
+    a = malloc(M * sizeof(complex_t));
+    b = malloc(M * sizeof(complex_t));
+    c = malloc(length * sizeof(complex_t));
+    if(a == NULL || b == NULL || c == NULL) {
+        free(a); free(b); free(c);
+        fft_error(ctx, "dft(): Error! unable to allocate memory");
+        return FFT_ERRORSTATUS;
+    }
+
+    // Plan for the convolution transforms (fft()'s own plan is left alone)
+    if((plan = fft_plan_create_r(ctx, M, FFT_ALG_DIT)) == NULL) {
+        free(a); free(b); free(c);
+        return FFT_ERRORSTATUS;
+    }
+
+    // Chirp, with n^2 taken mod 2N to keep the angle accurate for large n
+    for(n = 0; n < length; n++) {
+        wk = M_PI * (double)(((long long)n * n) % (2 * (long long)length)) / (double)length;
+        c[n].r = cos(wk);
+        c[n].i = sin(wk);
+    }
+
+    // a(n) = x(n) c*(n), zero padded. If inverse (synthesis)
+    // transform, pre-adjust values (conjugate)
+    for(n = 0; n < M; n++)
+        if(n < length) {
+            a[n].r = array[n].r * c[n].r + (inverse ? -1.0 : 1.0) * array[n].i * c[n].i;
+            a[n].i = (inverse ? -1.0 : 1.0) * array[n].i * c[n].r - array[n].r * c[n].i;
+        } else
+            a[n].r = a[n].i = 0.0;
+
+    // b(m) = c(m) for m from -(N-1) to N-1, wrapped for circular convolution
+    for(n = 0; n < M; n++)
+        b[n].r = b[n].i = 0.0;
+    for(n = 0; n < length; n++) {
+        b[n] = c[n];
+        if(n)
+            b[M - n] = c[n];
+    }
+
+    // Convolve: fft() normalises the forward transform by 1/M,
+    // so the product is scaled back up by M
+    fft_plan_execute(plan, a, 0);
+    fft_plan_execute(plan, b, 0);
+
+    for(n = 0; n < M; n++) {
+        tmp.r = M * (a[n].r * b[n].r - a[n].i * b[n].i);
+        tmp.i = M * (a[n].i * b[n].r + a[n].r * b[n].i);
+        a[n] = tmp;
+    }
+
+    fft_plan_execute(plan, a, 1);
+
+    // X(k) = c*(k) (a * b)(k). If inverse (synthesis) transform,
+    // post-adjust values (conjugate and normalise)
+    for(n = 0; n < length; n++) {
+        array[n].r = a[n].r * c[n].r + a[n].i * c[n].i;
+        array[n].i = a[n].i * c[n].r - a[n].r * c[n].i;
+
+        if(inverse) {
+            array[n].i /= -1.0 * length;
+            array[n].r /= length;
+        }
+    }
+
+    fft_plan_destroy(plan);
+    free(a); free(b); free(c);
+
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// fft_zoom()
+// -------------------------------------------------------------------------
+
+int fft_zoom (const complex_t x[], const int length, complex_t X[], const int M, const real_t f1, const real_t f2)
+{
+    return fft_zoom_r(&fft_global_ctx, x, length, X, M, f1, f2);
+}
+
+// -------------------------------------------------------------------------
+// fft_zoom_r()
+//
+// Chirp-z transform of the 'length' points of x[], giving M
+// points of the spectrum in X[], evenly spaced from f1 to f2
+// (in cycles per sample, so 0.5 is the Nyquist frequency).
+// With f = f1 + k df, where df = (f2 - f1)/(M - 1), and the
+// sign and normalisation as for fft():
+//
+//   X(k) = 1/N sum over n of x(n) exp(j 2 Pi f n)
+//
+// As n k = (n^2 + k^2 - (k - n)^2)/2, this is a convolution
+// with the chirp c(n) = exp(j Pi df n^2):
+//
+//   X(k) = c(k)/N sum over n of (x(n) exp(j 2 Pi f1 n) c(n)) c*(k - n)
+//
+// done with power of 2 transforms of no less than N + M - 1
+// points, rather than zero padding x[] to a transform of
+// 1/df points for the same bin spacing. The context's plan
+// is not used.
+// -------------------------------------------------------------------------
+
+int fft_zoom_r (fft_ctx_t *ctx, const complex_t x[], const int length, complex_t X[], const int M,
+                const real_t f1, const real_t f2)
+{
+    int n, L;
+    double df, wk;
+    complex_t *a, *b, w, tmp;
+    fft_plan_t *plan;
+
+    // Clear error message
+    if(ctx != NULL)
+        ctx->msg[0] = '\0';
+
+    if(length < 1 || M < 1) {
+        fft_error(ctx, "fft_zoom(): Error! input (%d) and output (%d) lengths must be at least 1", length, M);
+        return FFT_ERRORSTATUS;
+    }
+
+    // Frequency step between output points
+    df = (M > 1) ? (f2 - f1) / (M - 1) : 0.0;
+
+    // Convolution length, avoiding circular wrap of the result
+    for(L = 2; L < length + M - 1; L <<= 1)
+        ;
+
+    // Obtain some memory for the transform.
+    a = malloc(L * sizeof(complex_t));
+    b = malloc(L * sizeof(complex_t));
+    if(a == NULL || b == NULL) {
+        free(a); free(b);
+        fft_error(ctx, "fft_zoom(): Error! unable to allocate memory");
+        return FFT_ERRORSTATUS;
+    }
+
+    if((plan = fft_plan_create_r(ctx, L, FFT_ALG_DIT)) == NULL) {
+        free(a); free(b);
+        return FFT_ERRORSTATUS;
+    }
+
+    // a(n) = x(n) exp(j 2 Pi f1 n) c(n), zero padded. The angles
+    // are taken in cycles, mod 1, to keep them accurate for large n
+    for(n = 0; n < L; n++)
+        if(n < length) {
+            wk = 2 * M_PI * (cycles(f1, n) + cycles(0.5 * df, (double)n * n));
+            w.r = cos(wk);
+            w.i = sin(wk);
+            MULTC(a[n], x[n], w);
+        } else
+            a[n].r = a[n].i = 0.0;
+
+    // b(m) = c*(m) for m from -(N-1) to M-1, wrapped for circular convolution
+    for(n = 0; n < L; n++)
+        b[n].r = b[n].i = 0.0;
+    for(n = 0; n < M || n < length; n++) {
+        wk = 2 * M_PI * cycles(0.5 * df, (double)n * n);
+        w.r =  cos(wk);
+        w.i = -sin(wk);
+        if(n < M)
+            b[n] = w;
+        if(n && n < length)
+            b[L - n] = w;
+    }
+
+    // Convolve: fft() normalises the forward transform by 1/L,
+    // so the product is scaled back up by L
+    fft_plan_execute(plan, a, 0);
+    fft_plan_execute(plan, b, 0);
+
+    for(n = 0; n < L; n++) {
+        MULTC(tmp, a[n], b[n]);
+        a[n].r = L * tmp.r;
+        a[n].i = L * tmp.i;
+    }
+
+    fft_plan_execute(plan, a, 1);
+
+    // X(k) = c(k)/N (a * b)(k)
+    for(n = 0; n < M; n++) {
+        wk = 2 * M_PI * cycles(0.5 * df, (double)n * n);
+        w.r = cos(wk) / length;
+        w.i = sin(wk) / length;
+        MULTC(X[n], a[n], w);
+    }
+
+    fft_plan_destroy(plan);
+    free(a); free(b);
+
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// fft_probe()
+// -------------------------------------------------------------------------
+
+int fft_probe (const real_t x[], const int length, const real_t f[], const int K, complex_t X[])
+{
+    return fft_probe_r(&fft_global_ctx, x, length, f, K, X);
+}
+
+// -------------------------------------------------------------------------
+// fft_probe_r()
+//
+// Spectrum of the 'length' real points of x[] at the K
+// frequencies f[] (in cycles per sample), with the sign and
+// normalisation as for fft():
+//
+//   X(k) = 1/N sum over n of x(n) exp(j 2 Pi f(k) n)
+//
+// Each is found with a Goertzel recurrence, of one multiply
+// and two adds per point, run over x[] in reverse:
+//
+//   s(m) = x(N-1-m) + 2 cos(w) s(m-1) - s(m-2)
+//
+// for w = 2 Pi f(k), after which
+//
+//   X(k) = 1/N (s(N-1) - exp(-j w) s(N-2))
+//
+// Each recurrence is a dependent chain, so PROBE_LANES
+// frequencies are run together, as independent lanes which
+// the compiler may vectorise. The context is used only for
+// an error message.
+// -------------------------------------------------------------------------
+
+int fft_probe_r (fft_ctx_t *ctx, const real_t x[], const int length, const real_t f[], const int K, complex_t X[])
+{
+    int k, j, n, lanes;
+    double w, coeff[PROBE_LANES], s0[PROBE_LANES], s1[PROBE_LANES], s2[PROBE_LANES];
+
+    // Clear error message
+    if(ctx != NULL)
+        ctx->msg[0] = '\0';
+
+    if(length < 1 || K < 1) {
+        fft_error(ctx, "fft_probe(): Error! input (%d) and frequency list (%d) lengths must be at least 1", length, K);
+        return FFT_ERRORSTATUS;
+    }
+
+    for(k = 0; k < K; k += PROBE_LANES) {
+        lanes = (K - k < PROBE_LANES) ? K - k : PROBE_LANES;
+
+        // Unused lanes of the last group repeat its last frequency
+        for(j = 0; j < PROBE_LANES; j++) {
+            coeff[j] = 2 * cos(2 * M_PI * f[k + ((j < lanes) ? j : lanes - 1)]);
+            s1[j] = s2[j] = 0.0;
+        }
+
+        for(n = length-1; n >= 0; n--)
+            for(j = 0; j < PROBE_LANES; j++) {
+                s0[j] = x[n] + coeff[j] * s1[j] - s2[j];
+                s2[j] = s1[j];
+                s1[j] = s0[j];
+            }
+
+        for(j = 0; j < lanes; j++) {
+            w = 2 * M_PI * f[k + j];
+            X[k + j].r = (s1[j] - cos(w) * s2[j]) / length;
+            X[k + j].i = sin(w) * s2[j] / length;
+        }
+    }
+
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// cycles()
+//
+// Returns f m mod 1, for an angle of f m cycles. The
+// rounding error of the product, which is large compared
+// to the result for large m, is recovered with a fused
+// multiply-add and added back after the reduction.
+// -------------------------------------------------------------------------
+
+static double cycles (const double f, const double m)
+{
+    double p = f * m;
+
+    return fmod(p, 1.0) + fma(f, m, -p);
+}
+
+#ifdef COS_TABLE
+
+// -------------------------------------------------------------------------
+// Cosine table
+//
+// cos(2 Pi i/COS_TABLE_LEN) for i from 0 to COS_TABLE_LEN/4,
+// from which the cosine and sine at any multiple of a table
+// step are found by symmetry. The second octant is filled
+// from sin() of the complementary angle, so every entry is
+// from an argument of no more than Pi/4, where the library
+// functions are most accurate.
+// -------------------------------------------------------------------------
+
+static real_t cos_table[COS_TABLE_LEN/4 + 1];
+
+// -------------------------------------------------------------------------
+// cos_table_create()
+//
+// Fills the cosine table on the first call only, and waits
+// for the filling to finish in any thread calling at the
+// same time, so that afterwards the table is only read.
+// -------------------------------------------------------------------------
+
+#ifdef _WIN32
+static BOOL CALLBACK cos_table_fill_once (PINIT_ONCE once, PVOID param, PVOID *context)
+{
+    cos_table_fill();
+    return TRUE;
+}
+#endif
+
+static void cos_table_create (void)
+{
+#ifdef _WIN32
+    static INIT_ONCE once = INIT_ONCE_STATIC_INIT;
+
+    InitOnceExecuteOnce(&once, cos_table_fill_once, NULL, NULL);
+#else
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+    pthread_once(&once, cos_table_fill);
+#endif
+}
+
+static void cos_table_fill (void)
+{
+    int i;
+
+    for(i = 0; i <= COS_TABLE_LEN/4; i++)
+        cos_table[i] = (i <= COS_TABLE_LEN/8) ? cos((2 * M_PI * i) / COS_TABLE_LEN) :
+                                                sin((2 * M_PI * (COS_TABLE_LEN/4 - i)) / COS_TABLE_LEN);
+}
+
+// -------------------------------------------------------------------------
+// table_twiddles()
+//
+// W(k, length) for k from 0 to length/2 - 1, from the cosine
+// table. Up to COS_TABLE_LEN points, each factor is a table
+// step. Longer lengths have S = length/COS_TABLE_LEN factors
+// per table step, so with k = q S + r,
+//
+//   W(k, length) = W(q, COS_TABLE_LEN) W(r, length)
+//
+// taking just S factors W(r, length) from cos() and sin().
+// Only the first half cycle is needed, where
+//
+//   cos(2 Pi (N/4 + i)/N) = -sin(2 Pi i/N) = -cos(2 Pi (N/4 - i)/N)
+// -------------------------------------------------------------------------
+
+static void table_twiddles (complex_t W[], const int length)
+{
+    int q, r, i, stride, S;
+    complex_t c, f;
+
+    stride = (length < COS_TABLE_LEN) ? COS_TABLE_LEN/length : 1;
+    S      = (length > COS_TABLE_LEN) ? length/COS_TABLE_LEN : 1;
+
+    for(r = 0; r < S; r++) {
+        f.r =  cos((2 * M_PI * r) / length);
+        f.i =  sin((2 * M_PI * r) / length);
+
+        for(q = 0; q * S + r < (length >> 1); q++) {
+            // Table step of the factor, in the first or second quadrant
+            i = q * stride;
+            if(i <= COS_TABLE_LEN/4) {
+                c.r =  cos_table[i];
+                c.i =  cos_table[COS_TABLE_LEN/4 - i];
+            } else {
+                c.r = -cos_table[COS_TABLE_LEN/2 - i];
+                c.i =  cos_table[i - COS_TABLE_LEN/4];
+            }
+
+            if(r) {
+                MULTC(W[q * S + r], c, f);
+            } else
+                W[q * S] = c;
+        }
+    }
+}
+
+#endif
+
+// -------------------------------------------------------------------------
+// Bit reversal of the first 'length' points, using the plan's
+// precomputed bit reversed indexes. For a shorter length than
+// the plan's, the reversed index of idx is that of
+// idx * (plan length/length) in the plan's table. (Index
+// calculation adapted from "The Scientist & Engineer's Guide
+// to Digital Signal Processing", 2nd Ed., Steven W. Smith,
+// 1999.)
+// -------------------------------------------------------------------------
+
+static void bitrev(complex_t x[], const fft_plan_t *plan, const int length)
+{
+    int idx, a, stride;
+    complex_t tmp;
+
+    stride = plan->length / length;
+
+    // For the entire array ...
+    for (idx = 0; idx < length; idx++) {
+        a = plan->bitrev[idx * stride];
+
+        // Swap elements if index is < bit reversed index (could use
+        // 'greater than'---either would do; just don't swap twice)
+        if(idx < a) {
+            tmp = x[a];
+            x[a] = x[idx];
+            x[idx] = tmp;
+        }
+    }
+}
@@ -0,0 +1,621 @@
+//=============================================================
+//
+// Copyright (c) 1999-2023 Simon Southwell. All rights reserved.
+//
+// This file is part of the WinFilter FIR filter design utility.
+//
+// WinFilter is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// WinFilter is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with WinFilter. If not, see <http://www.gnu.org/licenses/>.
+//
+//=============================================================
+//
+// Benchmark of the transform functions. For each power of 2
+// length from 'min' to 'max' points (default 64 to 16M), each
+// kernel is timed, and its forward transform checked against
+// a long double reference transform. The results are printed
+// to stdout as CSV, one line per kernel and length:
+//
+//   kernel,length,reps,ns_per_transform,ns_per_point,gflops,max_error,bytes_per_point
+//
+// GFLOP/s counts 5 N log2(N) floating point operations for a
+// complex transform (2.5 N log2(N) for a real one), whatever
+// the algorithm, so the zoom and pruned kernels are rated as
+// the full transform they stand in for. For probe, it counts
+// the Goertzel recurrence's 3 N for each frequency. max_error
+// is the largest error of any point, relative to the largest
+// reference point. The single precision kernels are checked
+// against the same long double reference as the others.
+//
+// bytes_per_point is the memory traffic of the DIT and six
+// step transforms, for lengths too large for the cache, as
+// 32 bytes (a point read and written) for each pass over the
+// data: the bit reversal and each radix-2 or radix-4 stage
+// for DIT, and the two passes of six step. It is left empty
+// for the other kernels.
+//
+// The kernels are:
+//
+//   fft           fft(), planned as any wisdom says
+//   dit_none      DIT plan, scalar butterflies
+//   dit_sse2      DIT plan, SSE2 butterflies
+//   dit_avx2      DIT plan, AVX2/FMA butterflies
+//   sixstep       DIT plan, always using the six step transform
+//   stockham      Stockham plan
+//   split         DIT plan, on split complex data
+//   split_f       DIT plan, on single precision split data
+//   batch         fft_batch(), of BATCH_COUNT arrays, timed
+//                 per transform
+//   real          fft_real(), of the real parts only
+//   real_pruned   fft_real_pruned(), of the real parts with
+//                 1/PRUNE of them non-zero, as filter() does
+//   real_pruned_f fft_real_pruned_f(), of the same
+//   zoom          fft_zoom(), over the N bins of fft()
+//   probe         fft_probe(), of the real parts, at
+//                 PROBE_COUNT of the bins
+//   dft           dft()
+//
+// SIMD levels the CPU lacks are skipped, as is sixstep for
+// lengths below 64K, and batch and zoom above BATCH_MAX and
+// ZOOM_MAX points, where their buffers would be many times
+// the data. Complex transforms are timed in forward and
+// inverse pairs, so the data keeps its scale.
+//
+// This is not part of the WinFilter project, and needs only
+// the transform sources, so builds on any host, e.g.:
+//
+//   gcc -O2 -Iinclude -o fft_bench Code/fft_bench.c Code/fft.c
+//       Code/fft_split.c Code/fft_tune.c -lm -lpthread
+//
+// adding -fopenmp for the multi-threaded six step transform.
+//
+// USAGE:
+//
+//   fft_bench [-m <min>] [-M <max>] [-t <seconds>] [-w <wisdom file>]
+//
+//   -t sets the least time spent timing each kernel at each
+//   length (default 0.2s), and -w loads (and tunes) wisdom
+//   for fft().
+//
+//=============================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "fft.h"
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+#define DEFAULT_MIN     64
+#define DEFAULT_MAX     (1 << 24)
+#define DEFAULT_SECONDS 0.2
+
+// Shortest length with a six step sub-plan (SIXSTEP_MIN in fft.c)
+#define SIXSTEP_LENGTH  (1 << 16)
+
+// Memory traffic per point of a pass over complex data, reading
+// and writing each point
+#define PASS_BYTES      (2 * sizeof(complex_t))
+
+// Arrays transformed by each call of the batch kernel, and its
+// longest length
+#define BATCH_COUNT     8
+#define BATCH_MAX       (1 << 20)
+
+// Longest length for the zoom kernel, whose convolution is of
+// twice the length
+#define ZOOM_MAX        (1 << 22)
+
+// Fraction of the input the pruned kernels have non-zero, 1/PRUNE,
+// as fft_tune.c times
+#define PRUNE           32
+
+// Frequencies evaluated by the probe kernel
+#define PROBE_COUNT     16
+
+#define KERNELS         15
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+typedef struct {
+    long double r;
+    long double i;
+} complex_ld_t;
+
+// Kernels benchmarked
+typedef enum {
+    K_FFT, K_DIT_NONE, K_DIT_SSE2, K_DIT_AVX2, K_SIXSTEP, K_STOCKHAM, K_SPLIT, K_SPLIT_F, K_BATCH,
+    K_REAL, K_REAL_PRUNED, K_REAL_PRUNED_F, K_ZOOM, K_PROBE, K_DFT
+} kernel_t;
+
+// Data for a kernel: complex data x[] (BATCH_COUNT arrays for the
+// batch kernel), split data s or sf, real input in[] and the real
+// input kernels' output out[], and the probe frequencies f[]
+typedef struct {
+    complex_t         *x;
+    split_complex_t    s;
+    split_complex_f_t  sf;
+    real_t            *in;
+    complex_t         *out;
+    real_t            *f;
+} bench_data_t;
+
+// -------------------------------------------------------------------------
+// PROTOTYPES
+// -------------------------------------------------------------------------
+
+static int    bench      (const kernel_t kernel, const int length, const complex_ld_t ref[],
+                          const complex_ld_t pruned[], const double seconds);
+static int    run        (const kernel_t kernel, fft_plan_t *plan, bench_data_t *d, const int length,
+                          const int inverse);
+static double max_error  (const kernel_t kernel, const complex_t X[], const complex_ld_t ref[],
+                          const complex_ld_t pruned[], const int length);
+static int    traffic    (const kernel_t kernel, const int length);
+static void   reference  (complex_ld_t x[], const int length);
+static void   test_input (complex_t x[], const int length);
+static double now        (void);
+
+// -------------------------------------------------------------------------
+// GLOBALS
+// -------------------------------------------------------------------------
+
+static const char *kernel_names[KERNELS] = {
+    "fft", "dit_none", "dit_sse2", "dit_avx2", "sixstep", "stockham", "split", "split_f", "batch",
+    "real", "real_pruned", "real_pruned_f", "zoom", "probe", "dft"
+};
+
+// -------------------------------------------------------------------------
+// main()
+// -------------------------------------------------------------------------
+
+int main (int argc, char **argv)
+{
+    int min = DEFAULT_MIN, max = DEFAULT_MAX, length, n, kernel;
+    double seconds = DEFAULT_SECONDS;
+    complex_ld_t *ref, *pruned;
+    complex_t *x;
+
+    for(n = 1; n < argc; n++) {
+        if(!strcmp(argv[n], "-m") && n+1 < argc)
+            min = atoi(argv[++n]);
+        else if(!strcmp(argv[n], "-M") && n+1 < argc)
+            max = atoi(argv[++n]);
+        else if(!strcmp(argv[n], "-t") && n+1 < argc)
+            seconds = atof(argv[++n]);
+        else if(!strcmp(argv[n], "-w") && n+1 < argc) {
+            if(fft_set_wisdom(argv[++n], 1) != FFT_OKSTATUS) {
+                fprintf(stderr, "%s: %s\n", argv[0], fft_error_msg);
+                return 1;
+            }
+        } else {
+            fprintf(stderr, "Usage: %s [-m <min>] [-M <max>] [-t <seconds>] [-w <wisdom file>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if(min < 2 || (min & (min-1)) || max < min || (max & (max-1))) {
+        fprintf(stderr, "%s: Error! lengths must be powers of 2, from 2, with min <= max\n", argv[0]);
+        return 1;
+    }
+
+    printf("kernel,length,reps,ns_per_transform,ns_per_point,gflops,max_error,bytes_per_point\n");
+
+    for(length = min; length <= max && length > 0; length <<= 1) {
+        // Reference forward transforms of the test input, and of its
+        // pruned real parts, in long double
+        ref    = malloc(length * sizeof(complex_ld_t));
+        pruned = malloc(length * sizeof(complex_ld_t));
+        x      = malloc(length * sizeof(complex_t));
+        if(ref == NULL || pruned == NULL || x == NULL) {
+            fprintf(stderr, "%s: Error! unable to allocate memory for %d points\n", argv[0], length);
+            return 1;
+        }
+
+        test_input(x, length);
+        for(n = 0; n < length; n++) {
+            ref[n].r    = x[n].r;
+            ref[n].i    = x[n].i;
+            pruned[n].r = (n < (length + PRUNE - 1) / PRUNE) ? x[n].r : 0.0;
+            pruned[n].i = 0.0;
+        }
+        reference(ref, length);
+        reference(pruned, length);
+        free(x);
+
+        for(kernel = 0; kernel < KERNELS; kernel++)
+            if(bench((kernel_t)kernel, length, ref, pruned, seconds) != FFT_OKSTATUS) {
+                fprintf(stderr, "%s: %s failed at %d points: %s\n", argv[0], kernel_names[kernel],
+                        length, fft_error_msg);
+                return 1;
+            }
+
+        free(ref);
+        free(pruned);
+        fflush(stdout);
+    }
+
+    return 0;
+}
+
+// -------------------------------------------------------------------------
+// bench()
+//
+// Checks and times one kernel at one length, printing its
+// CSV line. Kernels the CPU or length can't do print
+// nothing.
+// -------------------------------------------------------------------------
+
+static int bench (const kernel_t kernel, const int length, const complex_ld_t ref[],
+                  const complex_ld_t pruned[], const double seconds)
+{
+    fft_plan_t *plan = NULL;
+    bench_data_t d = {NULL, {0, NULL, NULL}, {0, NULL, NULL}, NULL, NULL, NULL};
+    double start, elapsed = 0.0, error = 0.0, flops, e;
+    long reps, n;
+    int status = FFT_OKSTATUS, count = 1, b;
+
+    switch(kernel) {
+    case K_DIT_NONE:
+    case K_DIT_SSE2:
+    case K_DIT_AVX2:
+    case K_SIXSTEP:
+    case K_SPLIT:
+    case K_SPLIT_F:
+        if((plan = fft_plan_create_alg(length, FFT_ALG_DIT)) == NULL)
+            return FFT_ERRORSTATUS;
+
+        // Skip SIMD levels the CPU hasn't, and six steps without a sub-plan
+        if((kernel == K_DIT_SSE2 && plan->simd < FFT_SIMD_SSE2) ||
+           (kernel == K_DIT_AVX2 && plan->simd < FFT_SIMD_AVX2) ||
+           (kernel == K_SIXSTEP  && (plan->sub == NULL || length < SIXSTEP_LENGTH))) {
+            fft_plan_destroy(plan);
+            return FFT_OKSTATUS;
+        }
+
+        plan->sixstep = (kernel == K_SIXSTEP);
+        if(kernel == K_DIT_NONE || kernel == K_DIT_SSE2)
+            plan->simd = (kernel == K_DIT_NONE) ? FFT_SIMD_NONE : FFT_SIMD_SSE2;
+        break;
+    case K_STOCKHAM:
+        if((plan = fft_plan_create_alg(length, FFT_ALG_STOCKHAM)) == NULL)
+            return FFT_ERRORSTATUS;
+        break;
+    case K_BATCH:
+        if(length > BATCH_MAX)
+            return FFT_OKSTATUS;
+        count = BATCH_COUNT;
+        break;
+    case K_ZOOM:
+        if(length > ZOOM_MAX)
+            return FFT_OKSTATUS;
+        break;
+    default:
+        break;
+    }
+
+    if((d.x = malloc(count * length * sizeof(complex_t))) == NULL                            ||
+       ((kernel == K_REAL || kernel == K_REAL_PRUNED || kernel == K_REAL_PRUNED_F || kernel == K_PROBE) &&
+        (d.in = malloc(length * sizeof(real_t))) == NULL)                                    ||
+       ((kernel == K_REAL || kernel == K_REAL_PRUNED || kernel == K_REAL_PRUNED_F || kernel == K_PROBE ||
+         kernel == K_ZOOM) && (d.out = malloc(length * sizeof(complex_t))) == NULL)          ||
+       (kernel == K_PROBE   && (d.f = malloc(PROBE_COUNT * sizeof(real_t))) == NULL)         ||
+       (kernel == K_SPLIT   && split_alloc(&d.s, length) != FFT_OKSTATUS)                    ||
+       (kernel == K_SPLIT_F && split_alloc_f(&d.sf, length) != FFT_OKSTATUS)) {
+        sprintf(fft_error_msg, "unable to allocate memory");
+        status = FFT_ERRORSTATUS;
+    }
+
+    // Forward transform of the test input, for the error
+    if(status == FFT_OKSTATUS) {
+        for(b = 0; b < count; b++)
+            test_input(d.x + b * length, length);
+        if(kernel == K_SPLIT)
+            complex_to_split(d.x, &d.s);
+        if(kernel == K_SPLIT_F)
+            complex_to_split_f(d.x, &d.sf);
+        if(d.in != NULL)
+            for(n = 0; n < length; n++)
+                d.in[n] = d.x[n].r;
+        if(d.f != NULL)
+            for(n = 0; n < PROBE_COUNT; n++)
+                d.f[n] = (real_t)(n * (length / PROBE_COUNT)) / length;
+
+        status = run(kernel, plan, &d, length, 0);
+
+        if(kernel == K_SPLIT)
+            split_to_complex(&d.s, d.x);
+        if(kernel == K_SPLIT_F)
+            split_to_complex_f(&d.sf, d.x);
+
+        for(b = 0; b < count; b++) {
+            e = max_error(kernel, (d.out != NULL) ? d.out : d.x + b * length, ref, pruned, length);
+            error = (e > error) ? e : error;
+        }
+    }
+
+    // Time pairs of transforms, doubling the pairs until long enough
+    for(reps = 2; status == FFT_OKSTATUS; reps <<= 1) {
+        start = now();
+        for(n = 0; n < reps && status == FFT_OKSTATUS; n++)
+            status = run(kernel, plan, &d, length, (int)(n & 1));
+        elapsed = now() - start;
+
+        if(elapsed >= seconds || reps >= (1L << 30))
+            break;
+    }
+
+    if(status == FFT_OKSTATUS) {
+        if(kernel == K_PROBE)
+            flops = 3.0 * length * ((length < PROBE_COUNT) ? length : PROBE_COUNT);
+        else
+            flops = ((kernel == K_REAL || kernel == K_REAL_PRUNED || kernel == K_REAL_PRUNED_F) ? 2.5 : 5.0) *
+                    length * log2((double)length);
+
+        printf("%s,%d,%ld,%.1f,%.3f,%.3f,%.3e,", kernel_names[kernel], length, reps,
+               1e9 * elapsed / reps / count, 1e9 * elapsed / reps / count / length,
+               flops * count * reps / elapsed / 1e9, error);
+        if(traffic(kernel, length))
+            printf("%d", traffic(kernel, length));
+        printf("\n");
+    }
+
+    fft_plan_destroy(plan);
+    split_free(&d.s);
+    split_free_f(&d.sf);
+    free(d.in);
+    free(d.out);
+    free(d.f);
+    free(d.x);
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// run()
+//
+// One call of the given kernel: on d->x, or for the split
+// kernels on d->s or d->sf, or for the real input kernels
+// from d->in (always forward, as in[] is left unchanged)
+// into d->out. zoom is also forward only, from d->x into
+// d->out.
+// -------------------------------------------------------------------------
+
+static int run (const kernel_t kernel, fft_plan_t *plan, bench_data_t *d, const int length,
+                const int inverse)
+{
+    int nonzero = (length + PRUNE - 1) / PRUNE;
+
+    switch(kernel) {
+    case K_FFT:
+        return fft(d->x, length, inverse);
+    case K_DFT:
+        return dft(d->x, length, inverse);
+    case K_BATCH:
+        return fft_batch(d->x, length, BATCH_COUNT, inverse);
+    case K_REAL:
+        return fft_real(d->in, d->out, length);
+    case K_REAL_PRUNED:
+        return fft_real_pruned(d->in, d->out, length, nonzero);
+    case K_REAL_PRUNED_F:
+        return fft_real_pruned_f(d->in, d->out, length, nonzero);
+    case K_ZOOM:
+        return fft_zoom(d->x, length, d->out, length, 0.0, (real_t)(length - 1) / length);
+    case K_PROBE:
+        return fft_probe(d->in, length, d->f, (length < PROBE_COUNT) ? length : PROBE_COUNT, d->out);
+    case K_SPLIT:
+        return fft_plan_execute_split(plan, &d->s, inverse);
+    case K_SPLIT_F:
+        return fft_plan_execute_split_f(plan, &d->sf, inverse);
+    default:
+        return fft_plan_execute(plan, d->x, inverse);
+    }
+}
+
+// -------------------------------------------------------------------------
+// max_error()
+//
+// Largest error of X[] from the reference forward transform,
+// relative to the reference's largest point. The reference
+// is as fft() (exp(+j 2 Pi k n/N), normalised by 1/N). dft()
+// has the opposite sign and no normalisation, so its point k
+// is N times reference point N-k. For real input (the real
+// part of the test input), point k is the even part,
+// (ref(k) + conj(ref(N-k)))/2, and for the pruned real
+// input it is pruned[k]. The probe kernel's point j is bin
+// j N/PROBE_COUNT.
+// -------------------------------------------------------------------------
+
+static double max_error (const kernel_t kernel, const complex_t X[], const complex_ld_t ref[],
+                         const complex_ld_t pruned[], const int length)
+{
+    long double r, i, err, peak = 0.0, worst = 0.0;
+    int k, nk, j, step = (length < PROBE_COUNT) ? 1 : length / PROBE_COUNT;
+
+    for(k = 0; k < length; k++) {
+        nk = (length - k) & (length - 1);
+
+        if(kernel == K_DFT) {
+            r = ref[nk].r * length;
+            i = ref[nk].i * length;
+        } else if(kernel == K_REAL_PRUNED || kernel == K_REAL_PRUNED_F) {
+            r = pruned[k].r;
+            i = pruned[k].i;
+        } else if(kernel == K_REAL || kernel == K_PROBE) {
+            r = (ref[k].r + ref[nk].r) / 2;
+            i = (ref[k].i - ref[nk].i) / 2;
+        } else {
+            r = ref[k].r;
+            i = ref[k].i;
+        }
+
+        peak = (sqrtl(r * r + i * i) > peak) ? sqrtl(r * r + i * i) : peak;
+
+        // The probe kernel has only every step'th point
+        if(kernel == K_PROBE) {
+            if(k % step || k / step >= PROBE_COUNT)
+                continue;
+            j = k / step;
+        } else
+            j = k;
+
+        err = sqrtl((X[j].r - r) * (X[j].r - r) + (X[j].i - i) * (X[j].i - i));
+        worst = (err > worst) ? err : worst;
+    }
+
+    return (double)(worst / peak);
+}
+
+// -------------------------------------------------------------------------
+// traffic()
+//
+// Memory traffic, in bytes per point, of a kernel's passes
+// over the data, or 0 where not counted. A DIT transform
+// makes a bit reversal pass, then a pass for each radix-4
+// stage and for a single radix-2 stage with an odd number
+// of stages. Six step makes two, whatever the length.
+// -------------------------------------------------------------------------
+
+static int traffic (const kernel_t kernel, const int length)
+{
+    int stages, n;
+
+    for(stages = 0, n = 1; n < length; n <<= 1)
+        stages++;
+
+    switch(kernel) {
+    case K_DIT_NONE:
+    case K_DIT_SSE2:
+    case K_DIT_AVX2:
+        return (int)PASS_BYTES * (1 + (stages + 1) / 2);
+    case K_SIXSTEP:
+        return (int)PASS_BYTES * 2;
+    default:
+        return 0;
+    }
+}
+
+// -------------------------------------------------------------------------
+// reference()
+//
+// Forward transform of x[] in long double, in place, as
+// fft() would do it (exp(+j 2 Pi k n/N), normalised by 1/N),
+// with decimation in time radix-2 stages. The twiddle
+// factors are each from cosl() and sinl(), so the result is
+// accurate to a few long double rounding errors per stage,
+// well beyond the double precision transforms it checks.
+// -------------------------------------------------------------------------
+
+static void reference (complex_ld_t x[], const int length)
+{
+    const long double pi = 3.14159265358979323846264338327950288L;
+    complex_ld_t *W, t, u;
+    int a, b, n, k, m, half, stride;
+
+    W = malloc((length/2 + 1) * sizeof(complex_ld_t));
+    for(k = 0; k < length/2 + 1; k++) {
+        W[k].r = cosl(2 * pi * k / length);
+        W[k].i = sinl(2 * pi * k / length);
+    }
+
+    // Bit reversal
+    for(a = 0, n = 0; n < length; n++) {
+        if(n < a) {
+            t = x[n]; x[n] = x[a]; x[a] = t;
+        }
+        for(b = length >> 1; b && (a & b); b >>= 1)
+            a ^= b;
+        a |= b;
+    }
+
+    for(m = 2; m <= length; m <<= 1) {
+        half   = m >> 1;
+        stride = length / m;
+        for(n = 0; n < length; n += m)
+            for(k = 0; k < half; k++) {
+                u = x[n + k + half];
+                t.r = u.r * W[k * stride].r - u.i * W[k * stride].i;
+                t.i = u.r * W[k * stride].i + u.i * W[k * stride].r;
+                x[n + k + half].r = x[n + k].r - t.r;
+                x[n + k + half].i = x[n + k].i - t.i;
+                x[n + k].r += t.r;
+                x[n + k].i += t.i;
+            }
+    }
+
+    for(n = 0; n < length; n++) {
+        x[n].r /= length;
+        x[n].i /= length;
+    }
+
+    free(W);
+}
+
+// -------------------------------------------------------------------------
+// test_input()
+//
+// Fills x[] with the same pseudo-random values, uniform
+// between -1 and 1, for every kernel.
+// -------------------------------------------------------------------------
+
+static void test_input (complex_t x[], const int length)
+{
+    unsigned long seed = 1;
+    int n;
+
+    for(n = 0; n < length; n++) {
+        seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+        x[n].r = (real_t)seed / 0x40000000UL - 1.0;
+        seed = (seed * 1103515245UL + 12345UL) & 0x7fffffffUL;
+        x[n].i = (real_t)seed / 0x40000000UL - 1.0;
+    }
+}
+
+// -------------------------------------------------------------------------
+// now()
+//
+// Wall clock time in seconds, from a monotonic clock.
+// -------------------------------------------------------------------------
+
+static double now (void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER count, freq;
+
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+
+    return (double)count.QuadPart / (double)freq.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+#endif
+}
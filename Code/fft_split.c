@@ -0,0 +1,171 @@
+//=============================================================
+//
+// Copyright (c) 1999-2023 Simon Southwell. All rights reserved.
+//
+// This file is part of the WinFilter FIR filter design utility.
+//
+// WinFilter is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// WinFilter is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with WinFilter. If not, see <http://www.gnu.org/licenses/>.
+//
+//=============================================================
+//
+// Split complex (structure of arrays) data, with the real
+// and imaginary parts in separate arrays, each aligned to
+// SPLIT_ALIGN bytes. Loops over this layout have contiguous
+// real and imaginary lanes, so vectorise at full width.
+//
+// split_alloc() and split_free() manage the arrays, and
+// complex_to_split() and split_to_complex() convert to and
+// from the interleaved complex_t layout used by fft().
+//
+// fft_plan_execute_split() transforms split data with an
+// fft_plan_t, with the same results and normalisation as
+// fft_plan_execute(). The decimation in time stages are
+// used whatever the plan's algorithm.
+// fft_plan_execute_real_split() is the pruned real input
+// transform, as fft_plan_execute_real_pruned(), with split
+// results.
+//
+// The split stages use their own copy of the plan's radix-4
+// twiddle factors, with the real and imaginary parts in runs
+// for each multiple of k. Most plans are never executed on
+// split data, so the copy is not made with the plan, but on
+// the plan's first split execution, under a lock as threads
+// may share the plan. The plan is otherwise unchanged.
+//
+// The functions are instantiated from fft_split_tmpl.h for
+// both real_t and float data, the float versions having an
+// _f suffix and using split_complex_f_t. The float versions
+// have twice the SIMD width and half the memory traffic, for
+// use where the results need no more than single precision.
+//
+// RETURN:
+//
+//   split_alloc(), fft_plan_execute_split() and
+//   fft_plan_execute_real_split() return either
+//   FFT_OKSTATUS or FFT_ERRORSTATUS.
+//
+//=============================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "fft.h"
+#include "ivdep.h"
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+// No aliasing qualifier, so the butterfly loop may be vectorised
+#if defined(_MSC_VER) || defined(__GNUC__)
+#define RESTRICT __restrict
+#else
+#define RESTRICT
+#endif
+
+// Lock guarding the making of plans' split twiddle factors
+#ifdef _WIN32
+static SRWLOCK twiddle_lock = SRWLOCK_INIT;
+#define TWIDDLE_LOCK()   AcquireSRWLockExclusive(&twiddle_lock)
+#define TWIDDLE_UNLOCK() ReleaseSRWLockExclusive(&twiddle_lock)
+#else
+static pthread_mutex_t twiddle_lock = PTHREAD_MUTEX_INITIALIZER;
+#define TWIDDLE_LOCK()   pthread_mutex_lock(&twiddle_lock)
+#define TWIDDLE_UNLOCK() pthread_mutex_unlock(&twiddle_lock)
+#endif
+
+// -------------------------------------------------------------------------
+// PROTOTYPES
+// -------------------------------------------------------------------------
+
+static void *aligned_malloc (const size_t size);
+static void  aligned_free   (void *ptr);
+
+// -------------------------------------------------------------------------
+// Double (real_t) precision functions
+// -------------------------------------------------------------------------
+
+#define SPLIT_REAL        real_t
+#define SPLIT_T           split_complex_t
+#define SPLIT_NAME(_F)    _F
+#define SPLIT_TWIDDLE_RE  twiddle4_re
+#define SPLIT_TWIDDLE_IM  twiddle4_im
+
+#include "fft_split_tmpl.h"
+
+#undef SPLIT_REAL
+#undef SPLIT_T
+#undef SPLIT_NAME
+#undef SPLIT_TWIDDLE_RE
+#undef SPLIT_TWIDDLE_IM
+
+// -------------------------------------------------------------------------
+// Single (float) precision functions
+// -------------------------------------------------------------------------
+
+#define SPLIT_REAL        float
+#define SPLIT_T           split_complex_f_t
+#define SPLIT_NAME(_F)    _F##_f
+#define SPLIT_TWIDDLE_RE  twiddle4f_re
+#define SPLIT_TWIDDLE_IM  twiddle4f_im
+
+#include "fft_split_tmpl.h"
+
+#undef SPLIT_REAL
+#undef SPLIT_T
+#undef SPLIT_NAME
+#undef SPLIT_TWIDDLE_RE
+#undef SPLIT_TWIDDLE_IM
+
+// -------------------------------------------------------------------------
+// aligned_malloc()
+//
+// Returns memory aligned to SPLIT_ALIGN bytes, with the
+// pointer from malloc() stored just before it for
+// aligned_free().
+// -------------------------------------------------------------------------
+
+static void *aligned_malloc (const size_t size)
+{
+    void *raw, **aligned;
+
+    if((raw = malloc(size + SPLIT_ALIGN + sizeof(void *))) == NULL)
+        return NULL;
+
+    aligned = (void **)(((uintptr_t)raw + sizeof(void *) + SPLIT_ALIGN - 1) & ~(uintptr_t)(SPLIT_ALIGN - 1));
+    aligned[-1] = raw;
+
+    return aligned;
+}
+
+// -------------------------------------------------------------------------
+// aligned_free()
+// -------------------------------------------------------------------------
+
+static void aligned_free (void *ptr)
+{
+    if(ptr != NULL)
+        free(((void **)ptr)[-1]);
+}
@@ -0,0 +1,398 @@
+//=============================================================
+//
+// Copyright (c) 1999-2023 Simon Southwell. All rights reserved.
+//
+// This file is part of the WinFilter FIR filter design utility.
+//
+// WinFilter is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// WinFilter is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with WinFilter. If not, see <http://www.gnu.org/licenses/>.
+//
+//=============================================================
+//
+// Split complex functions, instantiated by fft_split.c once
+// for each precision. Before inclusion, the following must
+// be defined:
+//
+//   SPLIT_REAL         - element type (real_t or float)
+//   SPLIT_T            - split complex type of SPLIT_REAL arrays
+//   SPLIT_NAME(_F)     - function name for the precision
+//   SPLIT_TWIDDLE_RE   - plan field of the split radix-4
+//   SPLIT_TWIDDLE_IM     twiddle factors, as SPLIT_REAL
+//
+// No include guard, as this file is included more than once.
+//
+//=============================================================
+
+// -------------------------------------------------------------------------
+// PROTOTYPES
+// -------------------------------------------------------------------------
+
+static void SPLIT_NAME(radix4_split) (SPLIT_REAL * RESTRICT re, SPLIT_REAL * RESTRICT im,
+                                      const SPLIT_REAL * RESTRICT Wr, const SPLIT_REAL * RESTRICT Wi, const int m);
+static void SPLIT_NAME(split_stages) (const fft_plan_t *plan, const SPLIT_REAL Wr[], const SPLIT_REAL Wi[],
+                                      SPLIT_REAL re[], SPLIT_REAL im[], const int length, const int nonzero);
+static int  SPLIT_NAME(split_twiddles) (const fft_plan_t *plan, const SPLIT_REAL **Wr, const SPLIT_REAL **Wi);
+
+// -------------------------------------------------------------------------
+// split_alloc()
+//
+// Allocates aligned real and imaginary arrays of 'length'
+// points for s.
+// -------------------------------------------------------------------------
+
+int SPLIT_NAME(split_alloc) (SPLIT_T *s, const int length)
+{
+    s->length = length;
+    s->re     = aligned_malloc(length * sizeof(SPLIT_REAL));
+    s->im     = aligned_malloc(length * sizeof(SPLIT_REAL));
+
+    if(s->re == NULL || s->im == NULL) {
+        SPLIT_NAME(split_free)(s);
+        return FFT_ERRORSTATUS;
+    }
+
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// split_free()
+// -------------------------------------------------------------------------
+
+void SPLIT_NAME(split_free) (SPLIT_T *s)
+{
+    aligned_free(s->re);
+    aligned_free(s->im);
+
+    s->re     = NULL;
+    s->im     = NULL;
+    s->length = 0;
+}
+
+// -------------------------------------------------------------------------
+// complex_to_split()
+// -------------------------------------------------------------------------
+
+void SPLIT_NAME(complex_to_split) (const complex_t in[], SPLIT_T *out)
+{
+    int n;
+
+    for(n = 0; n < out->length; n++) {
+        out->re[n] = (SPLIT_REAL)in[n].r;
+        out->im[n] = (SPLIT_REAL)in[n].i;
+    }
+}
+
+// -------------------------------------------------------------------------
+// split_to_complex()
+// -------------------------------------------------------------------------
+
+void SPLIT_NAME(split_to_complex) (const SPLIT_T *in, complex_t out[])
+{
+    int n;
+
+    for(n = 0; n < in->length; n++) {
+        out[n].r = in->re[n];
+        out[n].i = in->im[n];
+    }
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute_split()
+//
+// As fft_plan_execute() for split data, which must be the
+// plan's length.
+// -------------------------------------------------------------------------
+
+int SPLIT_NAME(fft_plan_execute_split) (const fft_plan_t *plan, SPLIT_T *x, const int inverse)
+{
+    int n;
+    int length = plan->length;
+    SPLIT_REAL *re = x->re, *im = x->im;
+    const SPLIT_REAL *Wr, *Wi;
+
+    if(x->length != length || SPLIT_NAME(split_twiddles)(plan, &Wr, &Wi) != FFT_OKSTATUS)
+        return FFT_ERRORSTATUS;
+
+    // If inverse (synthesis) transform, pre-adjust values (conjugate)
+    if(inverse)
+        for(n = 0; n < length; n++)
+            im[n] = -im[n];
+
+    SPLIT_NAME(split_stages)(plan, Wr, Wi, re, im, length, length);
+
+    // If inverse (synthesis) transform, post-adjust values (conjugate)
+    if(inverse)
+        for(n = 0; n < length; n++)
+            im[n] = -im[n];
+    else
+        for(n = 0; n < length; n++) {
+            re[n] /= length;
+            im[n] /= length;
+        }
+
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_execute_real_split()
+//
+// As fft_plan_execute_real_pruned(), with the results in
+// split form in out, which must be the plan's length. The
+// input is packed as half length split data, transformed
+// and the even and odd spectra split out, as described in
+// fft.c. The twiddle factors W(k, N) for k below N/4 are
+// the first run of the N point radix-4 stage's, and the
+// k = N/4 point is unchanged by the split, so is skipped.
+// -------------------------------------------------------------------------
+
+int SPLIT_NAME(fft_plan_execute_real_split) (const fft_plan_t *plan, const real_t in[], SPLIT_T *out, const int nonzero)
+{
+    int k, n;
+    int length = plan->length, ndiv2 = length >> 1, ndiv4 = length >> 2;
+    int packed = (nonzero + 1) >> 1;
+    SPLIT_REAL *re = out->re, *im = out->im;
+    const SPLIT_REAL *Wr, *Wi;
+    SPLIT_REAL ar, ai, br, bi, Er, Ei, Or, Oi, tr, ti;
+
+    if(out->length != length || nonzero < 1 || nonzero > length ||
+       SPLIT_NAME(split_twiddles)(plan, &Wr, &Wi) != FFT_OKSTATUS)
+        return FFT_ERRORSTATUS;
+
+    // Pack the real data into the first half, evens in re[] and odds in im[]
+    for(n = 0; n < packed; n++) {
+        re[n] = (SPLIT_REAL)in[2*n];
+        im[n] = (2*n + 1 < nonzero) ? (SPLIT_REAL)in[2*n + 1] : (SPLIT_REAL)0.0;
+    }
+
+    // Half length complex transform
+    SPLIT_NAME(split_stages)(plan, Wr, Wi, re, im, ndiv2, packed);
+
+    // Split the DC and Nyquist points, which are purely real
+    tr = re[0];
+    ti = im[0];
+    re[0]     = tr + ti;   im[0]     = (SPLIT_REAL)0.0;
+    re[ndiv2] = tr - ti;   im[ndiv2] = (SPLIT_REAL)0.0;
+
+    // Split the remaining points, pairing k with N/2-k
+    if(ndiv4) {
+        Wr += 3 * (ndiv4 - 1);
+        Wi += 3 * (ndiv4 - 1);
+
+        for(k = 1; k < ndiv4; k++) {
+            ar =  re[k];
+            ai =  im[k];
+            br =  re[ndiv2 - k];
+            bi = -im[ndiv2 - k];
+
+            Er = (SPLIT_REAL)0.5 * (ar + br);
+            Ei = (SPLIT_REAL)0.5 * (ai + bi);
+            Or = (SPLIT_REAL)0.5 * (ai - bi);
+            Oi = (SPLIT_REAL)0.5 * (br - ar);
+
+            tr = Wr[k] * Or - Wi[k] * Oi;
+            ti = Wr[k] * Oi + Wi[k] * Or;
+
+            re[k]         =   Er + tr;
+            im[k]         =   Ei + ti;
+            re[ndiv2 - k] =   Er - tr;
+            im[ndiv2 - k] = -(Ei - ti);
+        }
+    }
+
+    // Fill in the upper half from the complex conjugate of the lower half
+    for(k = 1; k < ndiv2; k++) {
+        re[length - k] =  re[k];
+        im[length - k] = -im[k];
+    }
+
+    // Normalise, as for a forward complex transform
+    for(n = 0; n < length; n++) {
+        re[n] /= length;
+        im[n] /= length;
+    }
+
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// split_stages()
+//
+// As fft_stages() in fft.c, for a 'length' point transform
+// of split data, with the first 'nonzero' points used and
+// the stages up to length/K points pruned. Then a radix-2
+// stage if an odd number of stages remain, and radix-4 for
+// the rest, with the split twiddle factors Wr[] and Wi[].
+// -------------------------------------------------------------------------
+
+static void SPLIT_NAME(split_stages) (const fft_plan_t *plan, const SPLIT_REAL Wr[], const SPLIT_REAL Wi[],
+                                      SPLIT_REAL re[], SPLIT_REAL im[], const int length, const int nonzero)
+{
+    int idx, idx2, a, n, K, blocklen, stride, stages;
+    SPLIT_REAL tr, ti;
+
+    for(K = 1; K < nonzero; K <<= 1)
+        ;
+    blocklen = length / K;
+    stride   = plan->length / K;
+
+    // Zero any points between the non-zero inputs and K
+    for(idx = nonzero; idx < K; idx++)
+        re[idx] = im[idx] = (SPLIT_REAL)0.0;
+
+    // Bit reverse the first K points of both arrays
+    for(idx = 0; idx < K; idx++) {
+        a = plan->bitrev[idx * stride];
+        if(idx < a) {
+            tr = re[a]; re[a] = re[idx]; re[idx] = tr;
+            ti = im[a]; im[a] = im[idx]; im[idx] = ti;
+        }
+    }
+
+    // Copy each point over its block, working down
+    if(blocklen > 1)
+        for(idx2 = K-1; idx2 >= 0; idx2--) {
+            tr = re[idx2];
+            ti = im[idx2];
+            for(idx = 0; idx < blocklen; idx++) {
+                re[idx2 * blocklen + idx] = tr;
+                im[idx2 * blocklen + idx] = ti;
+            }
+        }
+
+    for(stages = 0, n = blocklen; n < length; n <<= 1)
+        stages++;
+
+    // Single radix-2 stage for an odd number of stages, with the
+    // plan's W(k, 2 blocklen) converted to the precision in use
+    if(stages & 1) {
+        const complex_t *W = plan->twiddle + blocklen - 1;
+
+        n = blocklen << 1;
+
+        for(idx2 = 0; idx2 < length; idx2 += n)
+            for(idx = 0; idx < blocklen; idx++) {
+                a  = idx2 + idx;
+                tr = re[a + blocklen] * (SPLIT_REAL)W[idx].r - im[a + blocklen] * (SPLIT_REAL)W[idx].i;
+                ti = im[a + blocklen] * (SPLIT_REAL)W[idx].r + re[a + blocklen] * (SPLIT_REAL)W[idx].i;
+                re[a + blocklen] = re[a] - tr;
+                im[a + blocklen] = im[a] - ti;
+                re[a]           += tr;
+                im[a]           += ti;
+            }
+
+        blocklen = n;
+    }
+
+    // Radix-4 stages
+    for(n = blocklen << 2; n <= length; n <<= 2)
+        for(idx2 = 0; idx2 < length; idx2 += n)
+            SPLIT_NAME(radix4_split)(re + idx2, im + idx2,
+                                     Wr + 3 * ((n >> 2) - 1), Wi + 3 * ((n >> 2) - 1), n >> 2);
+}
+
+// -------------------------------------------------------------------------
+// split_twiddles()
+//
+// Points Wr and Wi to the plan's split radix-4 twiddle
+// factors, first making them from plan->twiddle4 if this is
+// the plan's first split execution. Each n point stage's
+// W(k, n), W(2k, n) and W(3k, n) become three runs of n/4,
+// at the same offset as in twiddle4. Returns
+// FFT_ERRORSTATUS if they cannot be allocated.
+// -------------------------------------------------------------------------
+
+static int SPLIT_NAME(split_twiddles) (const fft_plan_t *plan, const SPLIT_REAL **Wr, const SPLIT_REAL **Wi)
+{
+    // The split twiddle factors are the only part of a plan made
+    // after it is created, so the only part written here
+    fft_plan_t *p = (fft_plan_t *)plan;
+    const complex_t *W4;
+    SPLIT_REAL *re, *im;
+    int n, m, k, length = plan->length;
+
+    TWIDDLE_LOCK();
+
+    if(p->SPLIT_TWIDDLE_RE == NULL) {
+        re = malloc(3 * (length/2) * sizeof(SPLIT_REAL));
+        im = malloc(3 * (length/2) * sizeof(SPLIT_REAL));
+
+        if(re == NULL || im == NULL) {
+            TWIDDLE_UNLOCK();
+            free(re);
+            free(im);
+            return FFT_ERRORSTATUS;
+        }
+
+        for(n = 4; n <= length; n <<= 1) {
+            W4 = plan->twiddle4 + 3 * ((n >> 2) - 1);
+            for(k = 0; k < (n >> 2); k++)
+                for(m = 0; m < 3; m++) {
+                    re[3 * ((n >> 2) - 1) + m * (n >> 2) + k] = (SPLIT_REAL)W4[3*k + m].r;
+                    im[3 * ((n >> 2) - 1) + m * (n >> 2) + k] = (SPLIT_REAL)W4[3*k + m].i;
+                }
+        }
+
+        p->SPLIT_TWIDDLE_RE = re;
+        p->SPLIT_TWIDDLE_IM = im;
+    }
+
+    *Wr = p->SPLIT_TWIDDLE_RE;
+    *Wi = p->SPLIT_TWIDDLE_IM;
+
+    TWIDDLE_UNLOCK();
+
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// radix4_split()
+//
+// Radix-4 butterflies for one block of 4m points (an n = 4m
+// point DFT), as radix4_scalar() in fft.c. The quarters of
+// re[] and im[] are distinct, and each twiddle array holds
+// W(k, n), W(2k, n) and W(3k, n) as consecutive runs of m,
+// so every access in the k loop is contiguous. As m is a
+// power of 2, a vector of iterations never spans quarters,
+// so the loop is marked as having no carried dependencies.
+// -------------------------------------------------------------------------
+
+static void SPLIT_NAME(radix4_split) (SPLIT_REAL * RESTRICT re, SPLIT_REAL * RESTRICT im,
+                                      const SPLIT_REAL * RESTRICT Wr, const SPLIT_REAL * RESTRICT Wi, const int m)
+{
+    int k;
+    SPLIT_REAL Ar, Ai, Br, Bi, Cr, Ci, Dr, Di;
+
+    IVDEP
+    for(k = 0; k < m; k++) {
+        // A = F0(k), B = W(k) F1(k), C = W(2k) F2(k), D = W(3k) F3(k)
+        Ar = re[k];
+        Ai = im[k];
+        Br = re[k + 2*m] * Wr[k]       - im[k + 2*m] * Wi[k];
+        Bi = im[k + 2*m] * Wr[k]       + re[k + 2*m] * Wi[k];
+        Cr = re[k +   m] * Wr[k +   m] - im[k +   m] * Wi[k +   m];
+        Ci = im[k +   m] * Wr[k +   m] + re[k +   m] * Wi[k +   m];
+        Dr = re[k + 3*m] * Wr[k + 2*m] - im[k + 3*m] * Wi[k + 2*m];
+        Di = im[k + 3*m] * Wr[k + 2*m] + re[k + 3*m] * Wi[k + 2*m];
+
+        // With W(n/4, n) = j, the four outputs are (A + C) + (B + D),
+        // (A - C) + j(B - D), (A + C) - (B + D) and (A - C) - j(B - D)
+        re[k]       = (Ar + Cr) + (Br + Dr);
+        im[k]       = (Ai + Ci) + (Bi + Di);
+        re[k + 2*m] = (Ar + Cr) - (Br + Dr);
+        im[k + 2*m] = (Ai + Ci) - (Bi + Di);
+        re[k +   m] = (Ar - Cr) - (Bi - Di);
+        im[k +   m] = (Ai - Ci) + (Br - Dr);
+        re[k + 3*m] = (Ar - Cr) + (Bi - Di);
+        im[k + 3*m] = (Ai - Ci) - (Br - Dr);
+    }
+}
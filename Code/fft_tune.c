@@ -0,0 +1,585 @@
+//=============================================================
+//
+// Copyright (c) 1999-2023 Simon Southwell. All rights reserved.
+//
+// This file is part of the WinFilter FIR filter design utility.
+//
+// WinFilter is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// WinFilter is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with WinFilter. If not, see <http://www.gnu.org/licenses/>.
+//
+//=============================================================
+//
+// FFT autotuning. For each length, the ways a plan might do
+// a transform (decimation in time or Stockham stages, each
+// SIMD level the CPU supports, and for large lengths with
+// or without the six step transform) are timed, and the
+// fastest recorded as 'wisdom'. The fastest depends on the
+// length and the host, so is measured rather than guessed.
+//
+// The transform timed is the one filter() does with the
+// plan: fft_plan_execute_real_pruned_r(), whose complex
+// stages are of half the length, with 1/TUNE_PRUNE of the
+// input non-zero, so that DIT is credited with its pruning
+// (which Stockham does without). The single precision split
+// transforms (fft_real_pruned_f() and the _split_f()
+// functions) use their own stages whatever the plan's
+// algorithm, SIMD level or six step use, so are left out of
+// the wisdom.
+//
+// fft_set_wisdom() names a wisdom file, loading any wisdom
+// already in it. With 'autotune' non-zero, a length with no
+// wisdom is tuned when first planned, and the file rewritten
+// with the result, so the tuning is done once per host, not
+// once per run. A NULL path forgets all wisdom.
+//
+// fft_tune() tunes a length straight away (replacing any
+// wisdom for it), saving to the wisdom file if one is set.
+//
+// fft_set_wisdom_r() and fft_tune_r() are reentrant versions,
+// putting any error message in the caller's fft_ctx_t rather
+// than fft_error_msg.
+//
+// fft_plan_create_tuned_r() creates a plan for a length as
+// its wisdom says, tuning first if enabled and there is no
+// wisdom for it, or else the default DIT plan. The plans
+// kept by fft() and the other functions keeping a plan are
+// made this way. As the wisdom may pick a Stockham plan,
+// which must not be shared between threads, the plans from
+// fft_plan_create() are not.
+//
+// The wisdom is shared by all threads, guarded by a lock,
+// so plans may be created in parallel. The lock is not held
+// while a length is timed, so two threads planning the same
+// untuned length will both tune it, and the first to finish
+// has its result kept.
+//
+// The file has one line per length, giving the algorithm
+// ("dit" or "stockham"), SIMD level ("none", "sse2" or
+// "avx2"), six step use ("auto", "off" or "on") and the
+// time per transform in nanoseconds, with '#' comments:
+//
+//   # length algorithm simd sixstep ns
+//   4096 dit avx2 auto 9840.2
+//
+// RETURN:
+//
+//   fft_set_wisdom() and fft_tune() return either
+//   FFT_OKSTATUS or FFT_ERRORSTATUS, with fft_error_msg
+//   (or ctx->msg, for the _r functions) pointing to an
+//   error message string for the latter.
+//   fft_plan_create_tuned_r() returns NULL on an error.
+//
+//=============================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "fft.h"
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+// Wisdom is kept for lengths of 2^0 to 2^(WISDOM_BITS-1)
+#define WISDOM_BITS  31
+
+// Minimum time for each measurement of a candidate, and the number
+// of measurements, the fastest being taken
+#define TUNE_CLOCKS  (CLOCKS_PER_SEC/50)
+#define TUNE_TRIALS  3
+
+// Fraction of the timed input that is non-zero, 1/TUNE_PRUNE. For
+// filter()'s 4096 point transform this is 128 points, near its
+// default of 120 coefficients
+#define TUNE_PRUNE   32
+
+// Shortest stages using the six step transform (SIXSTEP_MIN in fft.c)
+#define SIXSTEP_MIN  (1 << 16)
+
+// Longest line in a wisdom file
+#define WISDOM_LINE  256
+
+// Lock guarding the wisdom
+#ifdef _WIN32
+static SRWLOCK wisdom_lock = SRWLOCK_INIT;
+#define WISDOM_LOCK()   AcquireSRWLockExclusive(&wisdom_lock)
+#define WISDOM_UNLOCK() ReleaseSRWLockExclusive(&wisdom_lock)
+#else
+static pthread_mutex_t wisdom_lock = PTHREAD_MUTEX_INITIALIZER;
+#define WISDOM_LOCK()   pthread_mutex_lock(&wisdom_lock)
+#define WISDOM_UNLOCK() pthread_mutex_unlock(&wisdom_lock)
+#endif
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+// Fastest way found to do a transform of one length
+typedef struct {
+    int    known;     // Non-zero when the length has been tuned
+    int    algorithm; // FFT_ALG_DIT or FFT_ALG_STOCKHAM
+    int    simd;      // FFT_SIMD_NONE to FFT_SIMD_AVX2
+    int    sixstep;   // FFT_SIXSTEP_AUTO, 0 or 1
+    double ns;        // Time per transform
+} wisdom_t;
+
+// -------------------------------------------------------------------------
+// PROTOTYPES
+// -------------------------------------------------------------------------
+
+static int    set_wisdom   (const char *path, const int autotune, char *msg);
+static int    tune_now     (const int length, char *msg);
+static int    tune         (const int length, wisdom_t *result, char *msg);
+static double time_plan    (fft_ctx_t *ctx, const fft_plan_t *plan, const real_t in[], complex_t out[]);
+static int    load_wisdom  (const char *path, char *msg);
+static int    save_wisdom  (char *msg);
+static int    length_index (const int length);
+static int    name_index   (const char *name, const char *names[], const int count);
+
+// -------------------------------------------------------------------------
+// GLOBALS
+// -------------------------------------------------------------------------
+
+// Wisdom for each power of 2 length
+static wisdom_t wisdom[WISDOM_BITS];
+
+// Wisdom file, with an empty path for none, and whether to tune
+// lengths with no wisdom
+static char wisdom_path[FILENAME_MAX];
+static int  tuning = 0;
+
+// Names of the algorithms, SIMD levels and six step use in the file
+static const char *alg_names[]     = {"dit", "stockham"};
+static const char *simd_names[]    = {"none", "sse2", "avx2"};
+static const char *sixstep_names[] = {"auto", "off", "on"};
+
+// -------------------------------------------------------------------------
+// fft_set_wisdom()
+// -------------------------------------------------------------------------
+
+int fft_set_wisdom (const char *path, const int autotune)
+{
+    return set_wisdom(path, autotune, fft_error_msg);
+}
+
+// -------------------------------------------------------------------------
+// fft_set_wisdom_r()
+//
+// Reentrant fft_set_wisdom(), setting any error message in
+// the caller's context.
+// -------------------------------------------------------------------------
+
+int fft_set_wisdom_r (fft_ctx_t *ctx, const char *path, const int autotune)
+{
+    // Clear error message
+    if(ctx != NULL)
+        ctx->msg[0] = '\0';
+
+    return set_wisdom(path, autotune, (ctx != NULL) ? ctx->msg : NULL);
+}
+
+// -------------------------------------------------------------------------
+// fft_tune()
+// -------------------------------------------------------------------------
+
+int fft_tune (const int length)
+{
+    return tune_now(length, fft_error_msg);
+}
+
+// -------------------------------------------------------------------------
+// fft_tune_r()
+//
+// Reentrant fft_tune(), setting any error message in the
+// caller's context.
+// -------------------------------------------------------------------------
+
+int fft_tune_r (fft_ctx_t *ctx, const int length)
+{
+    // Clear error message
+    if(ctx != NULL)
+        ctx->msg[0] = '\0';
+
+    return tune_now(length, (ctx != NULL) ? ctx->msg : NULL);
+}
+
+// -------------------------------------------------------------------------
+// set_wisdom()
+//
+// Forgets any wisdom, then loads it from the file at 'path'
+// (if it exists) and sets it as the file to save to. Lengths
+// with no wisdom are tuned on first use if 'autotune' is
+// non-zero. Setting the same path again only changes that.
+// Any error message is put in msg[], if not NULL.
+// -------------------------------------------------------------------------
+
+static int set_wisdom (const char *path, const int autotune, char *msg)
+{
+    int status = FFT_OKSTATUS;
+
+    WISDOM_LOCK();
+
+    if(path == NULL || strcmp(path, wisdom_path)) {
+        memset(wisdom, 0, sizeof(wisdom));
+        wisdom_path[0] = '\0';
+
+        if(path != NULL) {
+            if(strlen(path) >= FILENAME_MAX) {
+                if(msg != NULL)
+                    sprintf(msg, "fft_set_wisdom(): Error! wisdom file path too long");
+                status = FFT_ERRORSTATUS;
+            } else {
+                strcpy(wisdom_path, path);
+                status = load_wisdom(path, msg);
+            }
+        }
+    }
+
+    tuning = (path != NULL) && autotune;
+
+    WISDOM_UNLOCK();
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// tune_now()
+//
+// Tunes 'length' now, saving the wisdom if a file is set.
+// Any error message is put in msg[], if not NULL.
+// -------------------------------------------------------------------------
+
+static int tune_now (const int length, char *msg)
+{
+    wisdom_t best;
+    int status;
+
+    if((status = tune(length, &best, msg)) != FFT_OKSTATUS)
+        return status;
+
+    WISDOM_LOCK();
+
+    wisdom[length_index(length)] = best;
+
+    if(wisdom_path[0] != '\0')
+        status = save_wisdom(msg);
+
+    WISDOM_UNLOCK();
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// fft_plan_create_tuned_r()
+//
+// Creates a plan for 'length' points as its wisdom says,
+// tuning it first if tuning is on and it has none. Without
+// wisdom, the plan is the default DIT plan. A failure to tune
+// or save (such as a read only wisdom file) leaves the
+// default plan rather than failing.
+// -------------------------------------------------------------------------
+
+fft_plan_t *fft_plan_create_tuned_r (fft_ctx_t *ctx, const int length)
+{
+    wisdom_t w = {0, FFT_ALG_DIT, FFT_SIMD_AVX2, FFT_SIXSTEP_AUTO, 0.0};
+    wisdom_t best;
+    fft_plan_t *plan;
+    int idx = length_index(length), untuned = 0;
+
+    if(idx >= 0) {
+        WISDOM_LOCK();
+
+        if(wisdom[idx].known)
+            w = wisdom[idx];
+        else
+            untuned = tuning;
+
+        WISDOM_UNLOCK();
+    }
+
+    // Tune without the lock, then keep the result unless another
+    // thread has tuned the length (or tuning was stopped) meanwhile
+    if(untuned && tune(length, &best, NULL) == FFT_OKSTATUS) {
+        WISDOM_LOCK();
+
+        if(!wisdom[idx].known && tuning) {
+            wisdom[idx] = best;
+            save_wisdom(NULL);
+        }
+
+        if(wisdom[idx].known)
+            w = wisdom[idx];
+
+        WISDOM_UNLOCK();
+    }
+
+    // Invalid lengths get the plan creation's error
+    if((plan = fft_plan_create_r(ctx, length, w.algorithm)) == NULL)
+        return NULL;
+
+    plan->simd    = (w.simd < plan->simd) ? w.simd : plan->simd;
+    plan->sixstep = w.sixstep;
+
+    return plan;
+}
+
+// -------------------------------------------------------------------------
+// tune()
+//
+// Times each candidate for a 'length' point real input
+// transform, and returns the fastest in 'result'. A DIT
+// plan is timed at each SIMD level up to the CPU's, and if
+// its half length stages are large enough for six steps,
+// with and without them. The Stockham stages have no SIMD
+// versions, so are timed once. The transforms are done with
+// a context of their own, as filter() does, so the six step
+// work buffer is allocated once.
+// Any error message is put in msg[], if not NULL. The wisdom
+// is not touched, so the lock need not be held.
+// -------------------------------------------------------------------------
+
+static int tune (const int length, wisdom_t *result, char *msg)
+{
+    fft_plan_t *dit, *stockham;
+    fft_ctx_t ctx;
+    real_t *in;
+    complex_t *out;
+    wisdom_t best = {1, FFT_ALG_DIT, FFT_SIMD_NONE, FFT_SIXSTEP_AUTO, 0.0};
+    double ns;
+    int n, simd, cpu_simd, sixstep, first, last;
+
+    if(length_index(length) < 0) {
+        if(msg != NULL)
+            sprintf(msg, "fft_tune(): Error! length (%d) is not a power of 2", length);
+        return FFT_ERRORSTATUS;
+    }
+
+    dit      = fft_plan_create_r(NULL, length, FFT_ALG_DIT);
+    stockham = fft_plan_create_r(NULL, length, FFT_ALG_STOCKHAM);
+    in       = malloc(length * sizeof(real_t));
+    out      = malloc(length * sizeof(complex_t));
+
+    if(dit == NULL || stockham == NULL || in == NULL || out == NULL) {
+        fft_plan_destroy(dit);
+        fft_plan_destroy(stockham);
+        free(in);
+        free(out);
+        if(msg != NULL)
+            sprintf(msg, "fft_tune(): Error! unable to allocate memory");
+        return FFT_ERRORSTATUS;
+    }
+
+    for(n = 0; n < length; n++)
+        in[n] = (real_t)(n % 7) - 3.0;
+
+    fft_ctx_init(&ctx);
+
+    // Six step on or off, if the plan's half length stages can use
+    // it, else by length
+    first = (dit->sub != NULL && length/2 >= SIXSTEP_MIN) ? 0 : FFT_SIXSTEP_AUTO;
+    last  = (dit->sub != NULL && length/2 >= SIXSTEP_MIN) ? 1 : FFT_SIXSTEP_AUTO;
+
+    cpu_simd = dit->simd;
+
+    for(simd = FFT_SIMD_NONE; simd <= cpu_simd; simd++)
+        for(sixstep = first; sixstep <= last; sixstep++) {
+            dit->simd    = simd;
+            dit->sixstep = sixstep;
+            ns = time_plan(&ctx, dit, in, out);
+
+            if(best.ns == 0.0 || ns < best.ns) {
+                best.simd    = simd;
+                best.sixstep = sixstep;
+                best.ns      = ns;
+            }
+        }
+
+    if((ns = time_plan(&ctx, stockham, in, out)) < best.ns) {
+        best.algorithm = FFT_ALG_STOCKHAM;
+        best.simd      = FFT_SIMD_NONE;
+        best.sixstep   = FFT_SIXSTEP_AUTO;
+        best.ns        = ns;
+    }
+
+    *result = best;
+
+    fft_ctx_free(&ctx);
+    fft_plan_destroy(dit);
+    fft_plan_destroy(stockham);
+    free(in);
+    free(out);
+
+    return FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// time_plan()
+//
+// Returns the time, in nanoseconds, for a real input
+// transform of in[] into out[] with 'plan', as filter()
+// does it, as the fastest of TUNE_TRIALS measurements of at
+// least TUNE_CLOCKS each.
+// -------------------------------------------------------------------------
+
+static double time_plan (fft_ctx_t *ctx, const fft_plan_t *plan, const real_t in[], complex_t out[])
+{
+    int nonzero = (plan->length < TUNE_PRUNE) ? 1 : plan->length / TUNE_PRUNE;
+    clock_t start, elapsed;
+    double ns, best = 0.0;
+    long reps, n;
+    int trial;
+
+    for(trial = 0; trial < TUNE_TRIALS; trial++) {
+        // Double the repeats until the time is long enough to measure
+        for(reps = 1; ; reps <<= 1) {
+            start = clock();
+            for(n = 0; n < reps; n++)
+                fft_plan_execute_real_pruned_r(ctx, plan, in, out, nonzero);
+            elapsed = clock() - start;
+
+            if(elapsed >= TUNE_CLOCKS || reps >= (1L << 30))
+                break;
+        }
+
+        ns = 1e9 * (double)elapsed / CLOCKS_PER_SEC / reps;
+        if(trial == 0 || ns < best)
+            best = ns;
+    }
+
+    return best;
+}
+
+// -------------------------------------------------------------------------
+// load_wisdom()
+//
+// Reads wisdom from 'path'. A missing file is not an error,
+// as it will be written once a length is tuned. Any error
+// message is put in msg[], if not NULL. The lock must be
+// held.
+// -------------------------------------------------------------------------
+
+static int load_wisdom (const char *path, char *msg)
+{
+    FILE *fp;
+    char line[WISDOM_LINE], alg[16], simd[16], sixstep[16];
+    wisdom_t w;
+    int length, idx, lineno = 0, status = FFT_OKSTATUS;
+
+    if((fp = fopen(path, "r")) == NULL)
+        return FFT_OKSTATUS;
+
+    while(fgets(line, WISDOM_LINE, fp) != NULL) {
+        lineno++;
+
+        if(line[strspn(line, " \t\r\n")] == '#' || line[strspn(line, " \t\r\n")] == '\0')
+            continue;
+
+        if(sscanf(line, "%d %15s %15s %15s %lf", &length, alg, simd, sixstep, &w.ns) != 5 ||
+           (idx         = length_index(length)) < 0                                  ||
+           (w.algorithm = name_index(alg, alg_names, 2)) < 0                         ||
+           (w.simd      = name_index(simd, simd_names, 3)) < 0                       ||
+           (w.sixstep   = name_index(sixstep, sixstep_names, 3) - 1) < FFT_SIXSTEP_AUTO) {
+            if(msg != NULL)
+                sprintf(msg, "fft_set_wisdom(): Error! bad wisdom at line %d of file", lineno);
+            status = FFT_ERRORSTATUS;
+            break;
+        }
+
+        w.known = 1;
+        wisdom[idx] = w;
+    }
+
+    fclose(fp);
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// save_wisdom()
+//
+// Writes all the wisdom to the wisdom file, putting any
+// error message in msg[], if not NULL. The lock must be held.
+// -------------------------------------------------------------------------
+
+static int save_wisdom (char *msg)
+{
+    FILE *fp;
+    int idx;
+
+    if((fp = fopen(wisdom_path, "w")) == NULL) {
+        if(msg != NULL)
+            sprintf(msg, "fft_tune(): Error! unable to write wisdom file");
+        return FFT_ERRORSTATUS;
+    }
+
+    fprintf(fp, "# length algorithm simd sixstep ns\n");
+    for(idx = 0; idx < WISDOM_BITS; idx++)
+        if(wisdom[idx].known)
+            fprintf(fp, "%d %s %s %s %.1f\n", 1 << idx,
+                    alg_names[wisdom[idx].algorithm],
+                    simd_names[wisdom[idx].simd],
+                    sixstep_names[wisdom[idx].sixstep + 1],
+                    wisdom[idx].ns);
+
+    return fclose(fp) ? FFT_ERRORSTATUS : FFT_OKSTATUS;
+}
+
+// -------------------------------------------------------------------------
+// length_index()
+//
+// Returns log2(length), or -1 if length is not a power of 2
+// (from 2) with room for wisdom.
+// -------------------------------------------------------------------------
+
+static int length_index (const int length)
+{
+    int idx;
+
+    if(length < 2 || (length & (length-1)))
+        return -1;
+
+    for(idx = 0; (1 << idx) < length; idx++)
+        ;
+
+    return (idx < WISDOM_BITS) ? idx : -1;
+}
+
+// -------------------------------------------------------------------------
+// name_index()
+//
+// Returns the index of 'name' in names[], or -1.
+// -------------------------------------------------------------------------
+
+static int name_index (const char *name, const char *names[], const int count)
+{
+    int idx;
+
+    for(idx = 0; idx < count; idx++)
+        if(!strcmp(name, names[idx]))
+            return idx;
+
+    return -1;
+}
@@ -26,6 +26,7 @@
 // -------------------------------------------------------------------------
 
 #include <stdlib.h>
+#include <stdio.h>
 #include <math.h>
 
 #include "filter.h"
@@ -37,10 +38,12 @@
 // -------------------------------------------------------------------------
 
 static void GenerateImpulse (real_t [], const ConfigStruct *);
-static void Window (real_t [], real_t [], const ConfigStruct *);
-static void Quantise (const real_t [], complex_t [], const ConfigStruct *);
+static int  Window (real_t [], real_t [], const ConfigStruct *);
+static real_t Quantise (real_t [], const ConfigStruct *);
 static void Convolve (const real_t [], const real_t [], real_t [], const int);
 static void Add (const real_t [], const real_t [], real_t [], const real_t, const real_t, const real_t, const int);
+static int  Zoom (const real_t [], complex_t [], const ConfigStruct *, fft_ctx_t *);
+static int  Probe (const real_t [], complex_t [], const real_t, const ConfigStruct *, fft_ctx_t *);
 
 // -------------------------------------------------------------------------
 // filter
@@ -48,14 +51,42 @@ static void Add (const real_t [], const real_t [], real_t [], const real_t, cons
 // Returns filter kernel/frequency response in CmplxResult,
 // and the window coefficients used in window. The filter
 // design parameters and configuration are passed in with
-// the config structure pointer. 
+// the config structure pointer. If a zoomed response is
+// configured (Nz non-zero), it follows the full response
+// in CmplxResult, which must then hold RESPONSETOTAL(C)
+// points. If probe frequencies are configured (Np
+// non-zero), only the response at each is returned, in
+// the first Np points of CmplxResult, relative to the
+// nominal pass band gain. With a wisdom file configured,
+// the transforms are planned as it says, tuning any length
+// not in it. Windows are kept in the window cache, so a
+// design with the same window as an earlier one reuses it.
 //                                                         
 // -------------------------------------------------------------------------
 
 DLLEXPORT int filter(complex_t CmplxResult[], real_t window[], ConfigStruct *config)
 {
     ConfigStruct *C1=config, config2, *C2=&config2;
-    real_t (*result)[], (*r1)[], (*r2)[];
+    real_t (*result)[], (*r1)[], (*r2)[], gain;
+    int n, status;
+    fft_ctx_t ctx;
+    char *msg;
+
+    /* The transforms' plan and errors are kept in a context of
+       this call's own, so designs may run in parallel */
+    fft_ctx_init(&ctx);
+
+    /* Load the FFT wisdom, tuning any new lengths. This is only
+       done on the first call for a wisdom file */
+    if(C1->wisdom != NULL && fft_set_wisdom_r(&ctx, C1->wisdom, TRUE)) {
+        msg = ctx.msg;
+        DisplayMessage(1, &msg);
+        return BADSTATUS;
+    }
+
+    /* Windows are reused between designs, in up to the
+       configured memory */
+    window_cache_budget((size_t)C1->wincache * 1024);
 
     /* Generate some space for the 'real_t' results */
     result = (real_t (*)[]) malloc(COEFFTOTAL * sizeof(real_t));
@@ -95,27 +126,125 @@ DLLEXPORT int filter(complex_t CmplxResult[], real_t window[], ConfigStruct *con
         GenerateImpulse(*result, C1);
             
     /* Multiply impulse response by a window */
-    Window(*result, window, C1);
+    if(Window(*result, window, C1)) {
+        free(result);
+        msg = "filter(): Error! Unable to generate the window\n";
+        DisplayMessage(1, &msg);
+        return BADSTATUS;
+    }
  
-    /* Quantise the result into integer values (if requested), 
-       and cast into a complex array */
-    Quantise(*result, CmplxResult, C1);
-
-    /* Free up the results space */
-    free(result);
+    /* Quantise the result into integer values (if requested),
+       padded with zeros to COEFFTOTAL points */
+    gain = Quantise(*result, C1);
 
     /* If impulse response wasn't requested, calculate frequency 
-       response. (Values in CmplxResult overwritten.) */
-    if(!C1->opimpulse)
-        if(fft(CmplxResult, COEFFTOTAL, FALSE)) {
-            DisplayMessage(1, (char **)fft_error_msg);
+       response. The impulse response is purely real, and only its
+       first N points are non-zero, so the pruned real input transform
+       is used, in single precision when the quantisation allows.
+       Otherwise cast the impulse response into the complex array. */
+    if(!C1->opimpulse) {
+        if(PROBING(C1))
+            status = Probe(*result, CmplxResult, gain, C1, &ctx);
+        else {
+            status = FLOATRESPONSE(C1) ? fft_real_pruned_f_r(&ctx, *result, CmplxResult, COEFFTOTAL, C1->N) :
+                                         fft_real_pruned_r  (&ctx, *result, CmplxResult, COEFFTOTAL, C1->N);
+            if(!status && C1->Nz > 0)
+                status = Zoom(*result, CmplxResult + COEFFTOTAL, C1, &ctx);
+        }
+        fft_ctx_free(&ctx);
+
+        if(status) {
+            free(result);
+            msg = ctx.msg;
+            DisplayMessage(1, &msg);
             return BADSTATUS;
         }
+    } else
+        for(n = 0; n < COEFFTOTAL; n++) {
+            CmplxResult[n].r = (*result)[n];
+            CmplxResult[n].i = 0.0;
+        }
+
+    /* Free up the results space */
+    free(result);
 
     /* Exit with good status */
     return(GOODSTATUS);
 }
 
+// -------------------------------------------------------------------------
+// Zoom
+//
+// Calculates the frequency response of the N point impulse
+// response over Fz1 to Fz2 Hz, at Nz points, with a chirp-z
+// transform. This resolves detail (such as ripple near a
+// band edge) finer than the COEFFTOTAL point transform's
+// Fs/COEFFTOTAL spacing, without a larger transform. The
+// results are scaled to match the full response, which is
+// normalised by COEFFTOTAL rather than N.
+//
+// -------------------------------------------------------------------------
+
+static int Zoom (const real_t result[], complex_t zoom[], const ConfigStruct *C, fft_ctx_t *ctx)
+{
+    complex_t *taps;
+    int n, status;
+
+    if((taps = malloc(C->N * sizeof(complex_t))) == NULL) {
+        sprintf(ctx->msg, "filter(): Error! unable to allocate memory for zoomed response");
+        return BADSTATUS;
+    }
+
+    for(n = 0; n < C->N; n++) {
+        taps[n].r = result[n];
+        taps[n].i = 0.0;
+    }
+
+    status = fft_zoom_r(ctx, taps, C->N, zoom, C->Nz, C->Fz1/C->Fs, C->Fz2/C->Fs);
+
+    for(n = 0; n < C->Nz && !status; n++) {
+        zoom[n].r *= (real_t)C->N / COEFFTOTAL;
+        zoom[n].i *= (real_t)C->N / COEFFTOTAL;
+    }
+
+    free(taps);
+
+    return status;
+}
+
+// -------------------------------------------------------------------------
+// Probe
+//
+// Calculates the frequency response of the N point impulse
+// response at just the Np probe frequencies, with Goertzel
+// recurrences. For the dozen or so frequencies of interest
+// when checking a design's attenuation (at interfering
+// tones, say), this is much less work than the full
+// COEFFTOTAL point transform. The results are divided by
+// the quantisation gain, so a pass band response is near 1
+// whatever Q.
+//
+// -------------------------------------------------------------------------
+
+static int Probe (const real_t result[], complex_t probe[], const real_t gain, const ConfigStruct *C, fft_ctx_t *ctx)
+{
+    real_t f[MAXPROBES];
+    int n, status;
+
+    /* Probe frequencies in cycles per sample */
+    for(n = 0; n < C->Np; n++)
+        f[n] = C->Fp[n] / C->Fs;
+
+    status = fft_probe_r(ctx, result, C->N, f, C->Np, probe);
+
+    for(n = 0; n < C->Np && !status; n++) {
+        probe[n].r *= (real_t)C->N / gain;
+        probe[n].i *= (real_t)C->N / gain;
+    }
+
+    return status;
+}
+
 // -------------------------------------------------------------------------
 // Quantise
 //
@@ -123,11 +252,13 @@ DLLEXPORT int filter(complex_t CmplxResult[], real_t window[], ConfigStruct *con
 // and scales to be between +/- 2**(Q-1) - 1 casting the
 // result as an integer. These would then be the coefficients
 // in a hardware implementation which uses integer
-// arithmetic.
+// arithmetic. The result is updated in place, and zero
+// padded up to COEFFTOTAL points. Returns the gain applied
+// (1 when not quantising to integers).
 //
 // -------------------------------------------------------------------------
 
-static void Quantise (const real_t result[], complex_t CmplxResult[], const ConfigStruct *C)
+static real_t Quantise (real_t result[], const ConfigStruct *C)
 {
     int n;
     real_t scale;
@@ -141,14 +272,14 @@ static void Quantise (const real_t result[], complex_t CmplxResult[], const Conf
        integer for studying quantisation effects. */
     for(n=0; n < COEFFTOTAL; n++) {
         if(n < C->N)
-            CmplxResult[n].r =  (C->Q < 0) ? (real_t)((float)result[n]) :
-                                (C->Q ? (real_t)((long64)(result[n] * scale)) : 
-                                      result[n]);
+            result[n] = (C->Q < 0) ? (real_t)((float)result[n]) :
+                        (C->Q ? (real_t)((long64)(result[n] * scale)) : 
+                                result[n]);
         else
-            CmplxResult[n].r = 0.0;
-
-        CmplxResult[n].i = 0.0;
+            result[n] = 0.0;
     }
+
+    return (C->Q > 0) ? scale : (real_t)1.0;
 }
 
 // -------------------------------------------------------------------------
@@ -165,13 +296,15 @@ static void GenerateImpulse (real_t result[], const ConfigStruct *C)
     int n;
     real_t tmp;
 
-    /* For n = -pi to +pi */
-    for(n = (-1 * C->N)/2; n <= C->N/2; n++) {
+    /* For n = 0 to +pi. The response is symmetric about n = 0,
+       so each value is also that for -n */
+    for(n = 0; n <= C->N/2; n++) {
         /* X(n) is 'sinc(2 Pi n Fc/Fs).' If spectral reversal is
            selected, multiply odd coefficents by -1. */
         tmp = sinc((real_t)n, C->Fc, C->Fs, C->inversion) *
-                             ((C->reversal && abs(n)%2) ? -1.0 : 1.0);
-        result[n + C->N/2] = tmp;
+                             ((C->reversal && n%2) ? -1.0 : 1.0);
+        result[C->N/2 + n] = tmp;
+        result[C->N/2 - n] = tmp;
     }
 }
 
@@ -185,19 +318,20 @@ static void GenerateImpulse (real_t result[], const ConfigStruct *C)
 //
 // -------------------------------------------------------------------------
 
-static void Window (real_t result[], real_t window[], const ConfigStruct *C)
+static int Window (real_t result[], real_t window[], const ConfigStruct *C)
 {
     int n; 
 
-    /* For n = -pi to +pi */
-    for(n = (-1 * C->N)/2; n <= C->N/2; n++) {
-        /* Calculate the window coefficient as determined by 
-           function pointed to with *(C->windowfunc).) */
-        window[n+(C->N/2)] = (*(C->windowfunc)) (C->a, (real_t) n, (real_t)C->N);
+    /* Generate the whole window for the selected type, or reuse
+       it from an earlier design */
+    if(window_cache_fill(C->window, C->a, (int)C->N, window))
+        return BADSTATUS;
 
-        /* Multiply result by current window coefficient */
-        result[n + C->N/2] *= window[n+(C->N/2)]; 
-    }
+    /* Multiply result by the window coefficients, from n = -pi to +pi */
+    for(n = 0; n <= 2*(C->N/2); n++)
+        result[n] *= window[n];
+
+    return GOODSTATUS;
 }
 
 // -------------------------------------------------------------------------
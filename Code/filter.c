@@ -94,7 +94,7 @@ int AnalyseFilter (int argc, char **argv)
         return(0);
 
     /* Generate some memory space for the results */
-    CmplxResult = malloc(COEFFTOTAL * sizeof(complex_t));
+    CmplxResult = malloc(RESPONSETOTAL(C) * sizeof(complex_t));
     WindowBuf = malloc(C->N * sizeof(real_t));
 
     /* Perform filter calculation for the given configuration (C),
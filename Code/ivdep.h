@@ -0,0 +1,44 @@
+//=============================================================
+//
+// Copyright (c) 1999-2023 Simon Southwell. All rights reserved.
+//
+// This file is part of the WinFilter FIR filter design utility.
+//
+// WinFilter is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// WinFilter is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with WinFilter. If not, see <http://www.gnu.org/licenses/>.
+//
+//=============================================================
+//
+// IVDEP, placed before a loop, tells the compiler the loop
+// has no loop carried dependencies, so it may vectorise it
+// without checking the arrays for overlap. Used by fft.c,
+// fft_split.c and window.c.
+//
+//=============================================================
+
+#ifndef _IVDEP_H_
+#define _IVDEP_H_
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+#if defined(__GNUC__)
+#define IVDEP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+#define IVDEP __pragma(loop(ivdep))
+#else
+#define IVDEP
+#endif
+
+#endif
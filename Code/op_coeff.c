@@ -50,9 +50,11 @@
 void OutputCoefficients (complex_t result[], real_t WindowBuf[], ConfigStruct *C)
 {
     char buf[DEFAULT_STR_SIZE], *str=buf;
-    int n, idx=0;
-    real_t mag[COEFFTOTAL], max=SMALLNUMBER, mag_dB, phase[COEFFTOTAL];
+    int n, idx=0, first, last, total;
+    real_t mag[2*COEFFTOTAL], max=SMALLNUMBER, mag_dB, phase[2*COEFFTOTAL];
     real_t freq_step;
+    split_complex_t s;
+    char *errmsg = "Error! unable to allocate memory for frequency response\n";
 
     /* If requested, output the WindowBuf coefficients to stderr */
     if(C->opwindow) {
@@ -74,6 +76,20 @@ void OutputCoefficients (complex_t result[], real_t WindowBuf[], ConfigStruct *C
        sampling frequency divided by the total number of points */
     freq_step = C->Fs/(real_t)COEFFTOTAL;
 
+    /* Points of the response to output: the first half of the full
+       response, the zoomed response which follows it, from Fz1
+       to Fz2 with its own frequency step, or the probed response */
+    first = 0;
+    last  = COEFFTOTAL/2;
+    total = COEFFTOTAL;
+    if(PROBING(C))
+        last = total = C->Np;
+    else if(C->Nz > 0) {
+        first     = COEFFTOTAL;
+        last      = total = COEFFTOTAL + C->Nz;
+        freq_step = (C->Fz2 - C->Fz1)/(real_t)(C->Nz - 1);
+    }
+
     /* Output impulse response coefficients as train of integers (if Q > 0),
        or as real_t numbers */
     if(C->opimpulse)
@@ -94,27 +110,44 @@ void OutputCoefficients (complex_t result[], real_t WindowBuf[], ConfigStruct *C
     /* Output frequency response (if not in dBs) scaled by max quantised
        impulse response value to make independant of Q */
     else if(!C->decibels && !C->magnitude && !C->phase)
-        for(n=0; n < COEFFTOTAL; n++)
+        for(n=first; n < ((C->Nz || PROBING(C)) ? last : COEFFTOTAL); n++)
             fprintf(C->fp, "%.20e %.20e%c\n", result[n].r, result[n].i, TRAILCHAR);
 
     /* Frequency response output to be in dBs */
     else {
-        /* Calculate magnitude  and phase values from complex results, 
-           and find maximum magnitude value for normalisation later on */
-        for(n=0; n < COEFFTOTAL; n++) {
-            mag[n] = sqrt(result[n].r*result[n].r + result[n].i*result[n].i);
-            phase[n] = (real_t)180.0 * atan(result[n].i/result[n].r)/M_PI;
-
-            /* Correct the phase to be in the right quadrant, based on the
-               sign of the real_t and imaginary parts */
-            if((result[n].r < 0.0) && (result[n].i < 0.0))
-                phase[n] -= (real_t)180.0;
-            else if((result[n].r < 0.0) && (result[n].i >= (real_t)0.0))
-                phase[n] += (real_t)180.0;
-            
-            if(mag[n] > max)
-                max = mag[n];
+        /* Split the complex results into separate real and imaginary
+           arrays, so each of the passes below runs over contiguous data */
+        if(split_alloc(&s, total) != FFT_OKSTATUS) {
+            DisplayMessage(1, &errmsg);
+            fclose(C->fp);
+            return;
         }
+        complex_to_split(result, &s);
+
+        /* Calculate magnitude  and phase values from complex results, 
+           and find maximum magnitude value for normalisation later on.
+           A zoomed response is normalised by the full response's
+           maximum, so it has the same scale. A probed response is
+           already relative to the pass band gain */
+        for(n=0; n < total; n++)
+            mag[n] = sqrt(s.re[n]*s.re[n] + s.im[n]*s.im[n]);
+
+        for(n=0; n < total; n++)
+            phase[n] = (real_t)180.0 * atan(s.im[n]/s.re[n])/M_PI;
+
+        /* Correct the phase to be in the right quadrant, based on the
+           sign of the real_t and imaginary parts: -180 in the third
+           quadrant and +180 in the second */
+        for(n=0; n < total; n++)
+            phase[n] += (s.re[n] < 0.0) ? ((s.im[n] < 0.0) ? (real_t)-180.0 : (real_t)180.0) : (real_t)0.0;
+
+        if(PROBING(C))
+            max = 1.0;
+        else
+            for(n=0; n < COEFFTOTAL; n++)
+                max = (mag[n] > max) ? mag[n] : max;
+
+        split_free(&s);
 
         /* Add some labels for Xgraph plotting */
         if(C->Xgraph && (!strncmp(C->plotprog, "xgraph", 6) || !strncmp(C->plotprog, "glgraph", 7))) {
@@ -129,7 +162,7 @@ void OutputCoefficients (complex_t result[], real_t WindowBuf[], ConfigStruct *C
         }
 
         /* Print out normalised response */
-        for(n=0; n < COEFFTOTAL/2; n++) {
+        for(n=first; n < last; n++) {
             /* Magnitude in decibels is 20log(mag(n)). Magnitude
                normalised by dividing with maximum value */
             if(C->decibels)
@@ -139,10 +172,20 @@ void OutputCoefficients (complex_t result[], real_t WindowBuf[], ConfigStruct *C
             if(mag_dB < PLOTMINIMUM)
                mag_dB = PLOTMINIMUM; 
 
-            /* Print out the selected response values */
-            fprintf(C->fp, "%d %.20e%c\n", (int)((real_t)n*freq_step), 
-                                       C->phase ? phase[n] :
-                                      (C->magnitude ? mag[n]/max : mag_dB), TRAILCHAR);
+            /* Print out the selected response values, with the finer
+               zoomed frequencies to 3 decimal places */
+            if(PROBING(C))
+                fprintf(C->fp, "%.3lf %.20e%c\n", C->Fp[n],
+                                           C->phase ? phase[n] :
+                                          (C->magnitude ? mag[n]/max : mag_dB), TRAILCHAR);
+            else if(C->Nz > 0)
+                fprintf(C->fp, "%.3lf %.20e%c\n", C->Fz1 + (real_t)(n - first)*freq_step,
+                                           C->phase ? phase[n] :
+                                          (C->magnitude ? mag[n]/max : mag_dB), TRAILCHAR);
+            else
+                fprintf(C->fp, "%d %.20e%c\n", (int)((real_t)n*freq_step), 
+                                           C->phase ? phase[n] :
+                                          (C->magnitude ? mag[n]/max : mag_dB), TRAILCHAR);
         }
     }
     fflush(C->fp);
@@ -32,11 +32,47 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <float.h>
 
 #include "fft.h"
+#include "ivdep.h"
 #include "window.h"
 #include "filter.h"
 
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+// Storage class giving each thread its own copy of a static variable
+#if defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define THREAD_LOCAL __thread
+#else
+#define THREAD_LOCAL
+#endif
+
+// Points between exact re-anchors of the cosine_sum() recurrence
+#define COSINE_ANCHOR 32
+
+// Fills the upper half of out[] with the expression _W, for n
+// running from 0 to h (as real_t), where out[h] is the centre
+#define WINDOW_LOOP(_W) {                               \
+    IVDEP for(i = h; i < L; i++) {                      \
+        const real_t n = (real_t)(i - h);               \
+        out[i] = (_W);                                  \
+    }                                                   \
+}
+
+// -------------------------------------------------------------------------
+// PROTOTYPES
+// -------------------------------------------------------------------------
+
+static real_t I0             (const real_t);
+static int    chebyshev_fill (const real_t, const int, real_t *);
+static double cheb_bin       (const double, const int, const int);
+static double Cheb           (double, double);
+
 // -------------------------------------------------------------------------
 // Sinc function
 //
@@ -181,15 +217,16 @@ real_t cauchy (const real_t a, const real_t n, const real_t N)
 
 real_t blackman (const real_t a, const real_t n, const real_t N)
 {
-    real_t wT;
+    real_t wT, x;
 
     /* Adjust range to be from 0 to 1, rather than -0.5 to +0.5 */
     wT = (0.5 + n/N);
 
     /* This function is 'like' a raised cosine in appearance,
-       but obviously it isn't quite */
-    return(0.42 - 0.5 * cos((2*M_PI) * wT) +
-           0.08 * cos(2.0 * (2*M_PI) * wT));
+       but obviously it isn't quite. cos(2x) = 2cos(x)^2 - 1 */
+    x = cos((2*M_PI) * wT);
+
+    return(0.42 - 0.5 * x + 0.08 * (2.0 * x * x - 1.0));
 }
 
 // -------------------------------------------------------------------------
@@ -208,16 +245,19 @@ real_t blackman (const real_t a, const real_t n, const real_t N)
 
 real_t blackman_harris (const real_t a, const real_t n, const real_t N)
 {
-    real_t wT;
+    real_t wT, x;
 
     /* Adjust range to be from 0 to 1, rather than -0.5 to +0.5 */
     wT = (0.5 + n/N);
 
     /* This function is 'like' a raised cosine in appearance,
-       but obviously it isn't quite */
-    return(0.35875 - 0.48829 * cos((2*M_PI) * wT) +
-           0.14128 * cos(2.0 * (2*M_PI) * wT) -
-           0.01168 * cos(3.0 * (2*M_PI) * wT));
+       but obviously it isn't quite. cos(2x) = 2cos(x)^2 - 1
+       and cos(3x) = 4cos(x)^3 - 3cos(x) */
+    x = cos((2*M_PI) * wT);
+
+    return(0.35875 - 0.48829 * x +
+           0.14128 * (2.0 * x * x - 1.0) -
+           0.01168 * (4.0 * x * x - 3.0) * x);
 }
 
 // -------------------------------------------------------------------------
@@ -238,14 +278,18 @@ real_t blackman_harris (const real_t a, const real_t n, const real_t N)
 
 real_t nuttall (const real_t a, const real_t n, const real_t N)
 {
-    real_t wT;
+    real_t wT, x;
 
     /* Adjust range to be from 0 to 1, rather than -0.5 to +0.5 */
     wT = (0.5 + n/N);
 
-    return(0.3635819 - 0.4891775 * cos((2*M_PI) * wT) +
-           0.1365995 * cos(2.0 * (2*M_PI) * wT) -
-           0.0106411 * cos(3.0 * (2*M_PI) * wT));
+    /* Harmonics from cos(2x) = 2cos(x)^2 - 1 and
+       cos(3x) = 4cos(x)^3 - 3cos(x) */
+    x = cos((2*M_PI) * wT);
+
+    return(0.3635819 - 0.4891775 * x +
+           0.1365995 * (2.0 * x * x - 1.0) -
+           0.0106411 * (4.0 * x * x - 3.0) * x);
 }
 
 // -------------------------------------------------------------------------
@@ -389,14 +433,18 @@ real_t vallepoisson (const real_t a, const real_t n, const real_t N)
 
 real_t kaiser (const real_t a, const real_t n, const real_t N)
 {
-    static real_t I0 (const real_t);
-    static real_t last_a = -1.0;
-    static real_t I0_a;
+    static THREAD_LOCAL int    cached = FALSE;
+    static THREAD_LOCAL real_t last_a;
+    static THREAD_LOCAL real_t I0_a;
 
     // Only need to calculate I0(a) once for a particular
-    // alpha (which is constant for a given window calculation)
-    if(last_a != a)
-        I0_a = I0(a);
+    // alpha (which is constant for a given window calculation).
+    // Each thread has its own copy, for parallel designs.
+    if(!cached || last_a != a) {
+        I0_a   = I0(a);
+        last_a = a;
+        cached = TRUE;
+    }
 
     return( I0(a * sqrt(1.0 - ((n*n)*4.0/(N*N)))) / I0_a);
 }
@@ -411,19 +459,24 @@ real_t kaiser (const real_t a, const real_t n, const real_t N)
 //    0       /     k!    2
 //            --+
 //           k = 1
-// Sum from k = 1 to 69 (ought to be accurate enough---can't
-// do infinity, but series terms converges toward 0 with increasing k)
+//
+// Each term is the previous one multiplied by (x/2)^2/k^2,
+// so no powers or factorials are needed. The terms rise to
+// a peak near k = x/2, then fall away, and the sum stops
+// once a term no longer changes it.
 //
 // -------------------------------------------------------------------------
 
 static real_t I0 (const real_t x)
 {
-    int k;
-    real_t sum = 0.0;
+    int k = 1;
+    real_t sum = 1.0, term = 1.0, q = 0.25 * x * x;
 
-    sum = 1.0;
-    for(k = 1; k <= 69; k++)
-        sum += pow((pow((x/2.0), (real_t) k) * (1.0/factorial(k))), 2.0);
+    do {
+        term *= q / ((real_t)k * k);
+        sum  += term;
+        k++;
+    } while(term > sum * DBL_EPSILON);
 
     return(sum);
 }
@@ -475,84 +528,151 @@ KaiserParamStruct design_kaiser_filter (const real_t Fd, const real_t Fs, const
 //
 // beta = cosh(1/(N-1) * acosh(10^a)), and Cheb(N, x) is Nth
 // order polynomial at point x. Denominator is constant, and
-// not calculated as the inverse transformed result is
-// normalised. An inverse DFT is used to obtain the time
-// domain values.
+// not calculated as the result is normalised to 1 at the
+// centre. The time domain value at n is the (real part of
+// the) inverse DFT of the response, summed directly, so
+// each point costs O(N). chebyshev_fill() generates the
+// whole window with a transform, and is used by
+// window_fill(). Nothing is kept between calls, so points
+// may be requested in any order, from any thread.
 //
 // -------------------------------------------------------------------------
 
 real_t chebyshev (const real_t a, const real_t n, const real_t N)
 {
-    static real_t Cheb(real_t, real_t);
-    double beta, dftmax = 1, result = 0;
-    static complex_t *buf = NULL;
-    int i, M, k, fft_status;
-
-    // Integer versions of length and point index
-    M = (int) N;
-    k = (int) n;
-
-    // If this is the first value, initialise the window table for the new value of 'a'
-    if(k == (-1 * M/2)) {
-
-        // In case buffer memory was not cleared on a previous run,
-        // clear it now for a new allocation
-        if(buf != NULL) {
-            free(buf);
-            buf = NULL;
-        }
+    int j, M = (int) N, k = (int) n;
+    double beta, X, sum = 0, centre = 0;
 
-        if((buf = calloc(M, sizeof(complex_t))) == NULL)
-            return 0;
+    beta = cosh(1/(N-1) * acosh(pow(10.0, a)));
 
-        // Calculate beta
-        beta = cosh(1/(N-1) * acosh(pow(10.0, a)));
+    for(j = 0; j < M; j++) {
+        X = cheb_bin(beta, M, j);
+        sum    += X * cos((2*M_PI) * (double)((long64)j * k % M) / M);
+        centre += X;
+    }
 
-        // Frequency response calculation
-        for(i = 0; i < M ; i++) {
-            buf[(i+M/2)%M].r = Cheb(N-1, beta * cos(M_PI * ((double)i - N/2)/N));
-            buf[i].i = 0;
-        }
+    return sum / centre;
+}
 
-        // Inverse transform to get time response
-        // DFT used if N is not a power of 2 (FFT needs power of 2 points).
-        if(M & (M-1))
-            fft_status = dft(buf, M, 1);
-        else
-            fft_status = fft(buf, M, 1);
-
-        // An error occured in the Fourier transform, so clean up and return
-        if(fft_status) {
-            DisplayMessage(1, (char **)fft_error_msg);
-            free(buf);
-            buf = NULL;
-            return 0;
-        }
+// -------------------------------------------------------------------------
+// chebyshev_fill
+//
+// Generates the 2(N/2)+1 points of a Chebyshev window, for
+// n = -N/2 to N/2, in out[]. The response bins are real and
+// symmetric, so only half of them are calculated, and the
+// window is real and even, so only the points for n = 0 to
+// N/2 are kept, then mirrored. For even N, the bins are
+// transformed as a real sequence, packed into an N/2 point
+// complex DFT (even bins real, odd imaginary), whose
+// results are separated into the N point transform:
+//
+//   E(k) = (Z(k) + Z*(N/2-k))/2,  O(k) = (Z(k) - Z*(N/2-k))/2j
+//
+//   X(k) = E(k) + exp(-j 2 Pi k/N) O(k)
+//
+// Odd lengths use an N point DFT. All the working memory
+// is allocated for the call.
+//
+// Returns 0 for success, or BADWINDOWSTATUS if the memory
+// could not be allocated, or the DFT failed.
+//
+// -------------------------------------------------------------------------
+
+static int chebyshev_fill (const real_t a, const int N, real_t *out)
+{
+    int j, P, status = 0, h = N/2;
+    double beta, phi, peak = 0;
+    complex_t *Z, E, O;
+    real_t *bins;
+    fft_ctx_t ctx;
+    char *msg;
+
+    // Transform length, halved for even N
+    P = (N & 1) ? N : N/2;
+
+    bins = malloc(N * sizeof(real_t));
+    Z    = malloc(P * sizeof(complex_t));
+    if(bins == NULL || Z == NULL) {
+        free(bins); free(Z);
+        return BADWINDOWSTATUS;
+    }
 
-        // Find max value
-        for(i = 0; i < M; i++)
-            if(dftmax < buf[i].r || i == 0)
-                dftmax =  buf[i].r;
+    beta = cosh(1/((real_t)N-1) * acosh(pow(10.0, a)));
 
-        // Normalise
-        for(i = 0; i < M; i++)
-            buf[i].r = buf[i].r / dftmax;
+    // The bins are symmetric about 0 for even N, and about (N-1)/2
+    // for odd, so each value is calculated once and stored twice
+    for(j = 0; j <= h; j++) {
+        bins[j] = cheb_bin(beta, N, j);
+        bins[(N & 1) ? N-1 - j : (N - j) % N] = bins[j];
     }
 
-    // Reference buffer only if memory allocation was successful
-    if(buf != NULL) {
-        // Extract window value from table - phase shift so it
-        // runs from (N/2  to 3N/2) mod N
-        result = buf[(k+M) % M].r;
+    for(j = 0; j < P; j++)
+        if(N & 1) {
+            Z[j].r = bins[j];
+            Z[j].i = 0.0;
+        } else {
+            Z[j].r = bins[2*j];
+            Z[j].i = bins[2*j + 1];
+        }
+
+    // Transform (a single point transforms to itself)
+    fft_ctx_init(&ctx);
+    if(P > 1)
+        status = dft_r(&ctx, Z, P, 0);
+    fft_ctx_free(&ctx);
+
+    if(status) {
+        msg = ctx.msg;
+        DisplayMessage(1, &msg);
+        free(bins); free(Z);
+        return BADWINDOWSTATUS;
+    }
 
-        // If this is the last point, free the memory
-        if(k == M/2 - 1) {
-            free(buf);
-            buf = NULL;
+    // Real part of the N point transform, for n = 0 to N/2
+    for(j = 0; j <= h; j++)
+        if(N & 1)
+            out[h + j] = Z[j].r;
+        else {
+            E.r = (Z[j % P].r + Z[(P - j) % P].r) / 2;
+            O.r = (Z[j % P].i + Z[(P - j) % P].i) / 2;
+            O.i = (Z[(P - j) % P].r - Z[j % P].r) / 2;
+            phi = (2*M_PI) * j / N;
+            out[h + j] = E.r + cos(phi) * O.r + sin(phi) * O.i;
         }
+
+    // Find max value
+    for(j = 0; j <= h; j++)
+        if(peak < out[h + j] || j == 0)
+            peak = out[h + j];
+
+    // Normalise and mirror
+    for(j = 0; j <= h; j++) {
+        out[h + j] = out[h + j] / peak;
+        out[h - j] = out[h + j];
     }
 
-    return result;
+    free(bins); free(Z);
+
+    return 0;
+}
+
+// -------------------------------------------------------------------------
+// cheb_bin
+//
+// Returns the Chebyshev window's response at bin j, of M
+// bins, for the given beta. The bins are those of an
+// inverse DFT with the response centred on bin 0, and for
+// odd M, offset by half a bin.
+//
+// -------------------------------------------------------------------------
+
+static double cheb_bin (const double beta, const int M, const int j)
+{
+    double c;
+
+    c = fabs(cos(M_PI * (j + ((M & 1) ? 0.5 : 0.0)) / M));
+
+    return Cheb(M-1, beta * c);
 }
 
 // -------------------------------------------------------------------------
@@ -567,3 +687,156 @@ static double Cheb(double n, double x)
         return cosh (n * acosh(x));
 }
 
+// -------------------------------------------------------------------------
+// cosine_sum
+//
+// Calculates h+1 points of a cosine sum window, for n = 0
+// to h,
+//
+//   w(n) = c0 + c1 cos(t n) + c2 cos(2 t n) + c3 cos(3 t n)
+//
+// cos(t n) is stepped from point to point by rotating
+// (cos(t n), sin(t n)) through t, and the harmonics are
+// Chebyshev polynomials in it, so each point is a few
+// multiply-adds. The rotation is re-anchored with cos()
+// and sin() every COSINE_ANCHOR points, so its rounding
+// errors cannot build up over long windows.
+//
+// -------------------------------------------------------------------------
+
+static void cosine_sum (const real_t c[], const real_t t, const int h, real_t out[])
+{
+    int n;
+    real_t p0, p1, p2, p3, cr, sr, cn = 1.0, sn = 0.0, tmp;
+
+    // Polynomial in cos(t n), from T2(x) = 2x^2 - 1 and T3(x) = 4x^3 - 3x
+    p0 = c[0] - c[2];
+    p1 = c[1] - 3.0 * c[3];
+    p2 = 2.0 * c[2];
+    p3 = 4.0 * c[3];
+
+    // Rotation by t
+    cr = cos(t);
+    sr = sin(t);
+
+    for(n = 0; n <= h; n++) {
+        if(n % COSINE_ANCHOR == 0) {
+            cn = cos(t * n);
+            sn = sin(t * n);
+        }
+
+        out[n] = p0 + cn * (p1 + cn * (p2 + cn * p3));
+
+        tmp = cn * cr - sn * sr;
+        sn  = sn * cr + cn * sr;
+        cn  = tmp;
+    }
+}
+
+// -------------------------------------------------------------------------
+// window_fill
+//
+// Generates a whole window in one call, rather than a point
+// at a time. The type is the window's character, as given
+// to the -w option ('h' Hamming, 'k' Kaiser, 'y' Chebyshev,
+// etc.), and out[] receives the points for n = -N/2 to N/2
+// (2(N/2)+1 of them), with the same values as the window's
+// point function. The von Hann ('v') and uniform ('u')
+// windows are the Hamming window, with a fixed alpha.
+//
+// Terms common to all the points are calculated once, and
+// each window is then a single loop with no calls other
+// than maths library functions, which the compiler may
+// vectorise. The cosine sum windows (Hamming, Blackman,
+// Blackman-Harris and Nuttall) use the cosine_sum()
+// recurrence instead. All the windows are symmetric about
+// n = 0, so only the points for n = 0 to N/2 are
+// calculated, and then mirrored. The Chebyshev window is
+// generated by chebyshev_fill().
+//
+// Returns 0 for success, or BADWINDOWSTATUS for an unknown
+// type, or if a Chebyshev window could not be generated.
+//
+// -------------------------------------------------------------------------
+
+int window_fill (const int type, const real_t a, const int N, real_t *out)
+{
+    int i, h = N/2, L = 2*(N/2) + 1;
+    real_t s, b, c, I0_a, c4[4];
+
+    // Scaling from n to x, where -1 < x < 1
+    s = 2.0 / N;
+
+    switch(type) {
+        case 'o':
+            WINDOW_LOOP((1.0 - fabs(s * n)) * cos(M_PI * s * n) + sin(M_PI * fabs(s * n))/M_PI);
+            break;
+        case 'r':
+            WINDOW_LOOP(1.0 - (s * n) * (s * n));
+            break;
+        case 'R':
+            WINDOW_LOOP((n == 0) ? 1.0 : (sin(M_PI * s * n) / (M_PI * s * n)));
+            break;
+        case 'V':
+            WINDOW_LOOP((fabs(s * n) < 0.5) ? (1.0 - 6 * (s * n) * (s * n) * (1 - fabs(s * n))) :
+                                              (2 * (1 - fabs(s * n)) * (1 - fabs(s * n)) * (1 - fabs(s * n))));
+            break;
+        case 'T':
+            c = M_PI / (1 - a);
+            WINDOW_LOOP((fabs(s * n) < a) ? 1.0 : (0.5 * (1.0 + cos(c * (fabs(s * n) - a)))));
+            break;
+        case 'p':
+            WINDOW_LOOP(exp(-a * fabs(s * n)));
+            break;
+        case 'c':
+            WINDOW_LOOP(1/(1 + (a * a * (s * n) * (s * n))));
+            break;
+        case 'C':
+            // Written as the point function, so cos() is never negative at the ends
+            WINDOW_LOOP(pow(cos(M_PI * n / N), a));
+            break;
+        case 't':
+            WINDOW_LOOP(1.0 - fabs(s * n));
+            break;
+        case 'b':
+            // Phase of (0.5 + n/N) turns is Pi + Pi s n, so the odd harmonics change sign
+            c4[0] = 0.42;      c4[1] = 0.5;       c4[2] = 0.08;      c4[3] = 0.0;
+            cosine_sum(c4, M_PI * s, h, out + h);
+            break;
+        case 'n':
+            c4[0] = 0.3635819; c4[1] = 0.4891775; c4[2] = 0.1365995; c4[3] = 0.0106411;
+            cosine_sum(c4, M_PI * s, h, out + h);
+            break;
+        case 'B':
+            c4[0] = 0.35875;   c4[1] = 0.48829;   c4[2] = 0.14128;   c4[3] = 0.01168;
+            cosine_sum(c4, M_PI * s, h, out + h);
+            break;
+        case 'k':
+            // I0(a) is common to all points
+            I0_a = 1.0 / I0(a);
+            WINDOW_LOOP(I0(a * sqrt(1.0 - ((n*n)*4.0/((real_t)N*N)))) * I0_a);
+            break;
+        case 'g':
+            c = -1.0 / (2.0 * a * a);
+            WINDOW_LOOP(exp(c * (M_PI * s * n) * (M_PI * s * n)));
+            break;
+        case 'v':
+        case 'u':
+        case 'h':
+            b = (type == 'v') ? VONHANN_ALPHA : (type == 'u') ? UNIFORM_ALPHA : a;
+            c4[0] = 1.0 - (2.0 * b); c4[1] = 2.0 * b;    c4[2] = 0.0;       c4[3] = 0.0;
+            cosine_sum(c4, M_PI * s, h, out + h);
+            break;
+        case 'y':
+            // Generated whole, with a transform, and already mirrored
+            return chebyshev_fill(a, N, out);
+        default:
+            return BADWINDOWSTATUS;
+    }
+
+    // Mirror the upper half into the lower
+    for(i = 0; i < h; i++)
+        out[i] = out[L-1 - i];
+
+    return 0;
+}
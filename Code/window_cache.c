@@ -0,0 +1,258 @@
+//=============================================================
+//
+// Copyright (c) 1999-2023 Simon Southwell. All rights reserved.
+//
+// This file is part of the WinFilter FIR filter design utility.
+//
+// WinFilter is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// WinFilter is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with WinFilter. If not, see <http://www.gnu.org/licenses/>.
+//
+//=============================================================
+//
+// Cache of generated window tables. A window depends only
+// on its type, parameter 'a' and length N, whatever the
+// rest of the design (cut off, quantisation, band width or
+// output), so a sweep over designs with the same window
+// need only generate it once.
+//
+// window_cache_fill() fills out[] as window_fill() does,
+// copying from the cache when the window is in it, and
+// otherwise generating it and adding a copy to the cache.
+// Callers only ever get copies, so a table can be evicted
+// whenever the cache needs the space, without invalidating
+// anything a caller holds.
+//
+// window_cache_budget() sets the most memory, in bytes, the
+// tables may use (WINDOW_CACHE_DEFAULT to start with). When
+// a new table would exceed it, the least recently used are
+// evicted. A budget of 0 empties the cache and disables it.
+//
+// The cache is shared by all threads, guarded by a lock,
+// so designs may run in parallel. The lock is not held
+// while a window is generated, so two threads missing on
+// the same window will both generate it, and the first to
+// finish adds it to the cache.
+//
+// RETURN:
+//
+//   window_cache_fill() returns window_fill()'s status.
+//
+//=============================================================
+
+// -------------------------------------------------------------------------
+// INCLUDES
+// -------------------------------------------------------------------------
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#include "window.h"
+
+// -------------------------------------------------------------------------
+// DEFINES
+// -------------------------------------------------------------------------
+
+// Lock guarding the cache
+#ifdef _WIN32
+static SRWLOCK cache_lock = SRWLOCK_INIT;
+#define CACHE_LOCK()   AcquireSRWLockExclusive(&cache_lock)
+#define CACHE_UNLOCK() ReleaseSRWLockExclusive(&cache_lock)
+#else
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#define CACHE_LOCK()   pthread_mutex_lock(&cache_lock)
+#define CACHE_UNLOCK() pthread_mutex_unlock(&cache_lock)
+#endif
+
+// -------------------------------------------------------------------------
+// TYPEDEFS
+// -------------------------------------------------------------------------
+
+// A cached window table, in a list from most to least recently used
+typedef struct window_entry_s {
+    struct window_entry_s *next;
+    int    type;      // Window type character
+    real_t a;         // Window parameter
+    int    N;         // Window length
+    int    points;    // Points in table, 2(N/2)+1
+    real_t *table;
+} window_entry_t;
+
+// -------------------------------------------------------------------------
+// PROTOTYPES
+// -------------------------------------------------------------------------
+
+static window_entry_t *lookup     (const int type, const real_t a, const int N);
+static void            evict      (const size_t limit);
+static size_t          entry_size (const int points);
+
+// -------------------------------------------------------------------------
+// GLOBALS
+// -------------------------------------------------------------------------
+
+// Most recently used table first
+static window_entry_t *cache = NULL;
+
+// Memory used by the tables, and the most they may use
+static size_t cache_used   = 0;
+static size_t cache_budget = WINDOW_CACHE_DEFAULT;
+
+// -------------------------------------------------------------------------
+// window_cache_fill()
+//
+// Fills out[] with the 2(N/2)+1 points of the window of the
+// given type, parameter and length, from the cache if there.
+// -------------------------------------------------------------------------
+
+int window_cache_fill (const int type, const real_t a, const int N, real_t *out)
+{
+    window_entry_t *entry;
+    int status, fits, points = 2*(N/2) + 1;
+
+    CACHE_LOCK();
+
+    fits = entry_size(points) <= cache_budget;
+
+    if((entry = lookup(type, a, N)) != NULL) {
+        memcpy(out, entry->table, points * sizeof(real_t));
+        CACHE_UNLOCK();
+        return 0;
+    }
+
+    CACHE_UNLOCK();
+
+    // Not cached, so generate it
+    if((status = window_fill(type, a, N, out)))
+        return status;
+
+    // Add a copy, if it fits in the budget. A failure to allocate
+    // just leaves it uncached.
+    if(!fits || (entry = malloc(sizeof(window_entry_t))) == NULL)
+        return 0;
+
+    if((entry->table = malloc(points * sizeof(real_t))) == NULL) {
+        free(entry);
+        return 0;
+    }
+
+    entry->type   = type;
+    entry->a      = a;
+    entry->N      = N;
+    entry->points = points;
+    memcpy(entry->table, out, points * sizeof(real_t));
+
+    CACHE_LOCK();
+
+    // Make room for the table, under the budget as it is now,
+    // unless another thread has added it meanwhile
+    if(entry_size(points) <= cache_budget && lookup(type, a, N) == NULL) {
+        evict(cache_budget - entry_size(points));
+
+        entry->next = cache;
+        cache       = entry;
+        cache_used += entry_size(points);
+        entry       = NULL;
+    }
+
+    CACHE_UNLOCK();
+
+    // Not added, so free the copy
+    if(entry != NULL) {
+        free(entry->table);
+        free(entry);
+    }
+
+    return 0;
+}
+
+// -------------------------------------------------------------------------
+// window_cache_budget()
+//
+// Sets the most memory the cached tables may use, evicting
+// the least recently used tables to bring them within it.
+// -------------------------------------------------------------------------
+
+void window_cache_budget (const size_t bytes)
+{
+    CACHE_LOCK();
+
+    cache_budget = bytes;
+    evict(bytes);
+
+    CACHE_UNLOCK();
+}
+
+// -------------------------------------------------------------------------
+// lookup()
+//
+// Returns the cached table for the window, moved to the
+// front of the list as the most recently used, or NULL if
+// it is not cached. The lock must be held.
+// -------------------------------------------------------------------------
+
+static window_entry_t *lookup (const int type, const real_t a, const int N)
+{
+    window_entry_t **link, *entry;
+
+    for(link = &cache; (entry = *link) != NULL; link = &entry->next)
+        if(entry->type == type && entry->a == a && entry->N == N) {
+            *link       = entry->next;
+            entry->next = cache;
+            cache       = entry;
+            return entry;
+        }
+
+    return NULL;
+}
+
+// -------------------------------------------------------------------------
+// evict()
+//
+// Frees the least recently used tables until those left use
+// no more than 'limit' bytes. The lock must be held.
+// -------------------------------------------------------------------------
+
+static void evict (const size_t limit)
+{
+    window_entry_t **link, *entry;
+
+    while(cache_used > limit) {
+        // Find the last table in the list
+        for(link = &cache; (*link)->next != NULL; link = &(*link)->next)
+            ;
+
+        entry = *link;
+        *link = NULL;
+
+        cache_used -= entry_size(entry->points);
+        free(entry->table);
+        free(entry);
+    }
+}
+
+// -------------------------------------------------------------------------
+// entry_size()
+//
+// Memory used by a cached table of 'points' points.
+// -------------------------------------------------------------------------
+
+static size_t entry_size (const int points)
+{
+    return sizeof(window_entry_t) + points * sizeof(real_t);
+}
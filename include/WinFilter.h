@@ -45,7 +45,7 @@
 
 #define MAXARGS                4
 
-#define MAXCMDARGS             20
+#define MAXCMDARGS             24
 #define MAXDISPLINES           50
 
 #define MAXFILENAMELEN         1024
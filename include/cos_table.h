@@ -1,4134 +0,0 @@
-//=============================================================
-// 
-// Copyright (c) 1999-2023 Simon Southwell. All rights reserved.
-//
-// Date: 11th March 1999
-//
-// Cosine table.
-//
-// This file is part of the WinFilter FIR filter design utility.
-//
-// WinFilter is free software: you can redistribute it and/or modify
-// it under the terms of the GNU General Public License as published by
-// the Free Software Foundation, either version 3 of the License, or
-// (at your option) any later version.
-//
-// WinFilter is distributed in the hope that it will be useful,
-// but WITHOUT ANY WARRANTY; without even the implied warranty of
-// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-// GNU General Public License for more details.
-//
-// You should have received a copy of the GNU General Public License
-// along with WinFilter. If not, see <http://www.gnu.org/licenses/>.
-//
-//=============================================================
-
-
-// This table was generated using the UNIX cos() function.  I think
-// it has a lot of errors, but have not analyzed the effect of it yet. Nice
-// thing about this table: I can use a poorly convergent method to generate
-// a better one.  If you want to use your own table, beware the size.
-
-#ifndef _COS_TABLE_H_
-#define _COS_TABLE_H_
-
-double cos_table[] = {
-1.0000000000000000000000000000000000000000000000000000e+00,
-9.9999882345170187925020854891045019030570983886718750e-01,
-9.9999529380957619117964441102230921387672424316406250e-01,
-9.9998941108192840321322591989883221685886383056640625e-01,
-9.9998117528260110908888691483298316597938537597656250e-01,
-9.9997058643097413987987920336308889091014862060546875e-01,
-9.9995764455196389786095778617891483008861541748046875e-01,
-9.9994234967602391161989316969993524253368377685546875e-01,
-9.9992470183914450299056397852837108075618743896484375e-01,
-9.9990470108285289807525941796484403312206268310546875e-01,
-9.9988234745421256111086449891445226967334747314453125e-01,
-9.9985764100582386060267481298069469630718231201171875e-01,
-9.9983058179582340319058175737154670059680938720703125e-01,
-9.9980116988788425569367745993076823651790618896484375e-01,
-9.9976940535121527897644000404397957026958465576171875e-01,
-9.9973528826056168306024574121693149209022521972656250e-01,
-9.9969881869620424996725205346592701971530914306640625e-01,
-9.9965999674395922269809489080216735601425170898437500e-01,
-9.9961882249517863829879615877871401607990264892578125e-01,
-9.9957529604674921763773909333394840359687805175781250e-01,
-9.9952941750109314256178549840115010738372802734375000e-01,
-9.9948118696616694567325112075195647776126861572265625e-01,
-9.9943060455546173237451057502767071127891540527343750e-01,
-9.9937767038800284780108995619229972362518310546875000e-01,
-9.9932238458834954375475945198559202253818511962890625e-01,
-9.9926474728659442359202103034476749598979949951171875e-01,
-9.9920475861836388631331828946713358163833618164062500e-01,
-9.9914241872481690531770937013789080083370208740234375e-01,
-9.9907772775264536146977434327709488570690155029296875e-01,
-9.9901068585407337696580043484573252499103546142578125e-01,
-9.9894129318685687124457217578310519456863403320312500e-01,
-9.9886954991428356098737140200682915747165679931640625e-01,
-9.9879545620517240500646494183456525206565856933593750e-01,
-9.9871901223387293811128984089009463787078857421875000e-01,
-9.9864021818026527110845336210331879556179046630859375e-01,
-9.9855907422975931364561574810068123042583465576171875e-01,
-9.9847558057329477421149022120516747236251831054687500e-01,
-9.9838973740734016093512082079541869461536407470703125e-01,
-9.9830154493389289260818486582138575613498687744140625e-01,
-9.9821100336047818846196832964778877794742584228515625e-01,
-9.9811811290014917918966830256977118551731109619140625e-01,
-9.9802287377148624081257821671897545456886291503906250e-01,
-9.9792528619859599547936568342265672981739044189453125e-01,
-9.9782535041111164453297988075064495205879211425781250e-01,
-9.9772306664419163624302200332749634981155395507812500e-01,
-9.9761843513851955478344279981683939695358276367187500e-01,
-9.9751145614030345409872779782745055854320526123046875e-01,
-9.9740212990127530279238499133498407900333404541015625e-01,
-9.9729045667869020697082760307239368557929992675781250e-01,
-9.9717643673532607717646669698297046124935150146484375e-01,
-9.9706007033948296225389640312641859054565429687500000e-01,
-9.9694135776498216117147421755362302064895629882812500e-01,
-9.9682029929116566790980868972837924957275390625000000e-01,
-9.9669689520289606043945696001173928380012512207031250e-01,
-9.9657114579055483538638782192720100283622741699218750e-01,
-9.9644305135004263007658664719201624393463134765625000e-01,
-9.9631261218277800129072829804499633610248565673828125e-01,
-9.9617982859569687015266481466824188828468322753906250e-01,
-9.9604470090125196701791310260887257754802703857421875e-01,
-9.9590722941741172125063030762248672544956207275390625e-01,
-9.9576741446765981713440396561054512858390808105468750e-01,
-9.9562525638099430569383230249513871967792510986328125e-01,
-9.9548075549192693856070945912506431341171264648437500e-01,
-9.9533391214048227979560579115059226751327514648437500e-01,
-9.9518472667219692873175063141388818621635437011718750e-01,
-9.9503319943811863179661258982378058135509490966796875e-01,
-9.9487933079480561637808477826183661818504333496093750e-01,
-9.9472312110432570264606511045712977647781372070312500e-01,
-9.9456457073425541537403660186100751161575317382812500e-01,
-9.9440368005767909576064766952185891568660736083984375e-01,
-9.9424044945318790222898996944422833621501922607421875e-01,
-9.9407487930487936633738854652619920670986175537109375e-01,
-9.9390697000235606051177228437154553830623626708984375e-01,
-9.9373672194072459884495174264884553849697113037109375e-01,
-9.9356413552059530402971176954451948404312133789062500e-01,
-9.9338921114808065304657702654367312788963317871093750e-01,
-9.9321194923479450000769475082051940262317657470703125e-01,
-9.9303235019785141002301998014445416629314422607421875e-01,
-9.9285041445986510488808107766089960932731628417968750e-01,
-9.9266614244894801899476988182868808507919311523437500e-01,
-9.9247953459870996706371215623221360146999359130859375e-01,
-9.9229059134825736698815035197185352444648742675781250e-01,
-9.9209931314219179654401159496046602725982666015625000e-01,
-9.9190570043060932725609291082946583628654479980468750e-01,
-9.9170975366909952519733906228793784976005554199218750e-01,
-9.9151147331874389667660807390348054468631744384765625e-01,
-9.9131085984611544414946138203958980739116668701171875e-01,
-9.9110791372327688986132443460519425570964813232421875e-01,
-9.9090263542778000971367191596073098480701446533203125e-01,
-9.9069502544266463406330558427725918591022491455078125e-01,
-9.9048508425645709341011979631730355322360992431640625e-01,
-9.9027281236316910817407688227831386029720306396484375e-01,
-9.9005821026229712256139237069874070584774017333984375e-01,
-9.8984127845882052820769558820757083594799041748046875e-01,
-9.8962201746320077599960995939909480512142181396484375e-01,
-9.8940042779138037687403084419202059507369995117187500e-01,
-9.8917650996478101443898367506335489451885223388671875e-01,
-9.8895026451030298986211164447013288736343383789062500e-01,
-9.8872169196032377858074369214591570198535919189453125e-01,
-9.8849079285269658701196249239728786051273345947265625e-01,
-9.8825756773074946437418475397862493991851806640625000e-01,
-9.8802201714328352633032181984162889420986175537109375e-01,
-9.8778414164457217783166242952574975788593292236328125e-01,
-9.8754394179435933676103331890772096812725067138671875e-01,
-9.8730141815785843473207705756067298352718353271484375e-01,
-9.8705657130575097379932003605063073337078094482421875e-01,
-9.8680940181418552725745030329562723636627197265625000e-01,
-9.8655991026477540817296585373696871101856231689453125e-01,
-9.8630809724459866938417462733923457562923431396484375e-01,
-9.8605396334619543896593540921458043158054351806640625e-01,
-9.8579750916756747614044797956012189388275146484375000e-01,
-9.8553873531217606185350632586050778627395629882812500e-01,
-9.8527764238894122161838140527834184467792510986328125e-01,
-9.8501423101223983813667928188806399703025817871093750e-01,
-9.8474850180190420800840911397244781255722045898437500e-01,
-9.8448045538322093150895852886606007814407348632812500e-01,
-9.8421009238692902520995176018914207816123962402343750e-01,
-9.8393741344921892277852748520672321319580078125000000e-01,
-9.8366241921173025453128957451554015278816223144531250e-01,
-9.8338511032155118130049231695011258125305175781250000e-01,
-9.8310548743121628501029363178531639277935028076171875e-01,
-9.8282355119870523640912551854853518307209014892578125e-01,
-9.8253930228744124075745958180050365626811981201171875e-01,
-9.8225274136628937249327009340049698948860168457031250e-01,
-9.8196386910955524296440444231848232448101043701171875e-01,
-9.8167268619698311304944127186900004744529724121093750e-01,
-9.8137919331375456089006092952331528067588806152343750e-01,
-9.8108339115048670553420606665895320475101470947265625e-01,
-9.8078528040323043057924223830923438072204589843750000e-01,
-9.8048486177346938497123574052238836884498596191406250e-01,
-9.8018213596811742949199697250151075422763824462890625e-01,
-9.7987710369951763755835827396367676556110382080078125e-01,
-9.7956976568544051886533452488947659730911254882812500e-01,
-9.7926012264908202098467882024124264717102050781250000e-01,
-9.7894817531906219709725291977520100772380828857421875e-01,
-9.7863392442942320759158292275969870388507843017578125e-01,
-9.7831737071962765472932233024039305746555328369140625e-01,
-9.7799851493455713935532003233674913644790649414062500e-01,
-9.7767735782450992942926859541330486536026000976562500e-01,
-9.7735390014520007184728456195443868637084960937500000e-01,
-9.7702814265775439483974196264171041548252105712890625e-01,
-9.7670008612871184183745754125993698835372924804687500e-01,
-9.7636973133002114000333904186845757067203521728515625e-01,
-9.7603707903903902387554580855066888034343719482421875e-01,
-9.7570213003852857003295184767921455204486846923828125e-01,
-9.7536488511665697664909657760290428996086120605468750e-01,
-9.7502534506699412020225281594321131706237792968750000e-01,
-9.7468351068851066809628491682815365493297576904296875e-01,
-9.7433938278557585821459952057921327650547027587890625e-01,
-9.7399296216795594460791107849217951297760009765625000e-01,
-9.7364424965081197704819260252406820654869079589843750e-01,
-9.7329324605469824671644119007396511733531951904296875e-01,
-9.7293995220556017677893123618559911847114562988281250e-01,
-9.7258436893473221296346764574991539120674133300781250e-01,
-9.7222649707893626924715135828591883182525634765625000e-01,
-9.7186633748027939638802763511193916201591491699218750e-01,
-9.7150389098625178352364173406385816633701324462890625e-01,
-9.7113915844972509283650197176029905676841735839843750e-01,
-9.7077214072895035013033293580519966781139373779296875e-01,
-9.7040283868755550233942130944342352449893951416015625e-01,
-9.7003125319454397423868385885725729167461395263671875e-01,
-9.6965738512429244799761818285332992672920227050781250e-01,
-9.6928123535654853171195100003387778997421264648437500e-01,
-9.6890280477642887202449628603062592446804046630859375e-01,
-9.6852209427441737776831587325432337820529937744140625e-01,
-9.6813910474636244440915788800339214503765106201171875e-01,
-9.6775383709347551075552473776042461395263671875000000e-01,
-9.6736629222232850544571647333214059472084045410156250e-01,
-9.6697647104485207059099138859892264008522033691406250e-01,
-9.6658437447833311928491184517042711377143859863281250e-01,
-9.6619000344541261515729502207250334322452545166015625e-01,
-9.6579335887408368499507105298107489943504333496093750e-01,
-9.6539444169768939829623377590905874967575073242187500e-01,
-9.6499325285492032477918655786197632551193237304687500e-01,
-9.6458979328981275802590289458748884499073028564453125e-01,
-9.6418406395174582890206238516839221119880676269531250e-01,
-9.6377606579543984022251379428780637681484222412109375e-01,
-9.6336579978095404630522580191609449684619903564453125e-01,
-9.6295326687368387741372544041951186954975128173828125e-01,
-9.6253846804435916340025869430974125862121582031250000e-01,
-9.6212140426904158019283386238384991884231567382812500e-01,
-9.6170207652912254037147476992686279118061065673828125e-01,
-9.6128048581132063965526413085171952843666076660156250e-01,
-9.6085663310767965850089922241750173270702362060546875e-01,
-9.6043051941556578654513032233808189630508422851562500e-01,
-9.6000214573766595727022377104731276631355285644531250e-01,
-9.5957151308198451733488809622940607368946075439453125e-01,
-9.5913862246184189430664446263108402490615844726562500e-01,
-9.5870347489587159905966018413892015814781188964843750e-01,
-9.5826607140801767226179208591929636895656585693359375e-01,
-9.5782641302753290801774710416793823242187500000000000e-01,
-9.5738450078897585626691579818725585937500000000000000e-01,
-9.5694033573220882438192802510457113385200500488281250e-01,
-9.5649391890239510161109137698076665401458740234375000e-01,
-9.5604525134999640556543454295024275779724121093750000e-01,
-9.5559433413077110586186790897045284509658813476562500e-01,
-9.5514116830577078243180721983662806451320648193359375e-01,
-9.5468575494133833814203171641565859317779541015625000e-01,
-9.5422809510910566732633242281735874712467193603515625e-01,
-9.5376818988599032511643827092484571039676666259765625e-01,
-9.5330604035419386210747916265972889959812164306640625e-01,
-9.5284164760119871573351701954379677772521972656250000e-01,
-9.5237501271976587879919406987028196454048156738281250e-01,
-9.5190613680793234596677621084381826221942901611328125e-01,
-9.5143502096900833819859144568908959627151489257812500e-01,
-9.5096166631157508231098063333774916827678680419921875e-01,
-9.5048607394948170234982853799010626971721649169921875e-01,
-9.5000824500184299914451457880204543471336364746093750e-01,
-9.4952818059303667475035126699367538094520568847656250e-01,
-9.4904588185270055689102264295797795057296752929687500e-01,
-9.4856134991573026749023256343207322061061859130859375e-01,
-9.4807458592227622506953821357456035912036895751953125e-01,
-9.4758559101774120225769593162112869322299957275390625e-01,
-9.4709436635277721716619225844624452292919158935546875e-01,
-9.4660091308328353498779961228137835860252380371093750e-01,
-9.4610523237040344834980487576103769242763519287109375e-01,
-9.4560732538052139073414537051576189696788787841796875e-01,
-9.4510719328526060500905714434338733553886413574218750e-01,
-9.4460483726148025684921094580204226076602935791015625e-01,
-9.4410025849127265917815066131879575550556182861328125e-01,
-9.4359345816196038558842928978265263140201568603515625e-01,
-9.4308443746609349478404737965320236980915069580078125e-01,
-9.4257319760144686604519392858492210507392883300781250e-01,
-9.4205973977101731264838235802017152309417724609375000e-01,
-9.4154406518302080630888895029784180223941802978515625e-01,
-9.4102617505088925753398143569938838481903076171875000e-01,
-9.4050607059326829517686974213575012981891632080078125e-01,
-9.3998375303401404678993458219338208436965942382812500e-01,
-9.3945922360218991897795604018028825521469116210937500e-01,
-9.3893248353206459899666924684424884617328643798828125e-01,
-9.3840353406310805794987572880927473306655883789062500e-01,
-9.3787237643998988545490647084079682826995849609375000e-01,
-9.3733901191257495977282587773515842854976654052734375e-01,
-9.3680344173592156042928991155349649488925933837890625e-01,
-9.3626566717027825959007714118342846632003784179687500e-01,
-9.3572568948108036934740994183812290430068969726562500e-01,
-9.3518350993894761025160278222756460309028625488281250e-01,
-9.3463912981968078064198834908893331885337829589843750e-01,
-9.3409255040425898108935598429525271058082580566406250e-01,
-9.3354377297883617270457534687011502683162689208984375e-01,
-9.3299279883473895669254716267460025846958160400390625e-01,
-9.3243962926846235550470964881242252886295318603515625e-01,
-9.3188426558166814750450157589511945843696594238281250e-01,
-9.3132670908118042607526376741589047014713287353515625e-01,
-9.3076696107898371224109723698347806930541992187500000e-01,
-9.3020502289221906888627700027427636086940765380859375e-01,
-9.2964089584318132519769051214097999036312103271484375e-01,
-9.2907458125931585701806625365861691534519195556640625e-01,
-9.2850608047321558924380724420188926160335540771484375e-01,
-9.2793539482261788720052209100686013698577880859375000e-01,
-9.2736252565040111495164865118567831814289093017578125e-01,
-9.2678747430458174871859000631957314908504486083984375e-01,
-9.2621024213831137927854797453619539737701416015625000e-01,
-9.2563083050987282618393692246172577142715454101562500e-01,
-9.2504924078267758424942712736083194613456726074218750e-01,
-9.2446547432526260390517336418270133435726165771484375e-01,
-9.2387953251128673848313610506011173129081726074218750e-01,
-9.2329141671952763559261256887111812829971313476562500e-01,
-9.2270112833387862849576777080073952674865722656250000e-01,
-9.2210866874334518339395572184002958238124847412109375e-01,
-9.2151403934204201284785540337907150387763977050781250e-01,
-9.2091724152918952306379196670604869723320007324218750e-01,
-9.2031827670911059424696532005327753722667694091796875e-01,
-9.1971714629122736095467871564324013888835906982421875e-01,
-9.1911385169005777040496241170330904424190521240234375e-01,
-9.1850839432521225180749979699612595140933990478515625e-01,
-9.1790077562139049671685597786563448607921600341796875e-01,
-9.1729099700837801734110144025180488824844360351562500e-01,
-9.1667905992104270485043571170535869896411895751953125e-01,
-9.1606496579933172075271841094945557415485382080078125e-01,
-9.1544871608826783315748798486310988664627075195312500e-01,
-9.1483031223794619712919029552722349762916564941406250e-01,
-9.1420975570353069095119735720800235867500305175781250e-01,
-9.1358704794525080750133838591864332556724548339843750e-01,
-9.1296219042839821256052346143405884504318237304687500e-01,
-9.1233518462332274800985487672733142971992492675781250e-01,
-9.1170603200542987831767050010967068374156951904296875e-01,
-9.1107473405517636066974773711990565061569213867187500e-01,
-9.1044129225806724736713704260182566940784454345703125e-01,
-9.0980570810465222209018065768759697675704956054687500e-01,
-9.0916798309052238025174119684379547834396362304687500e-01,
-9.0852811871630612117201053479220718145370483398437500e-01,
-9.0788611648766626149864578110282309353351593017578125e-01,
-9.0724197791529581635927570459898561239242553710937500e-01,
-9.0659570451491533482624163298169150948524475097656250e-01,
-9.0594729780726845902449895220343023538589477539062500e-01,
-9.0529675931811881550714815602987073361873626708984375e-01,
-9.0464409057824624049715112050762400031089782714843750e-01,
-9.0398929312344333819595476597896777093410491943359375e-01,
-9.0333236849451181704750979406526312232017517089843750e-01,
-9.0267331823725882600228942465037107467651367187500000e-01,
-9.0201214390249317975900567034841515123844146728515625e-01,
-9.0134884704602202809553546103416010737419128417968750e-01,
-9.0068342922864697008833445579512044787406921386718750e-01,
-9.0001589201616027935415331739932298660278320312500000e-01,
-8.9934623697934157338096383682568557560443878173828125e-01,
-8.9867446569395381672507028270047158002853393554687500e-01,
-8.9800057974073987931973306331201456487178802490234375e-01,
-8.9732458070541831762767515101586468517780303955078125e-01,
-8.9664647017868026601661313179647549986839294433593750e-01,
-8.9596624975618521791176362967235036194324493408203125e-01,
-8.9528392103855758410446696871076710522174835205078125e-01,
-8.9459948563138269594929852246423251926898956298828125e-01,
-8.9391294514520325265038991346955299377441406250000000e-01,
-8.9322430119551532445854036268428899347782135009765625e-01,
-8.9253355540276457791293296395451761782169342041015625e-01,
-8.9184070939234272312745588351390324532985687255859375e-01,
-8.9114576479458318392090632187318988144397735595703125e-01,
-8.9044872324475787817021910086623392999172210693359375e-01,
-8.8974958638307277691836816302384249866008758544921875e-01,
-8.8904835585466457370529269610415212810039520263671875e-01,
-8.8834503330959635469810109498212113976478576660156250e-01,
-8.8763962040285393495508969863294623792171478271484375e-01,
-8.8693211879434219468976152711547911167144775390625000e-01,
-8.8622253014888063837872778094606474041938781738281250e-01,
-8.8551085613619995307033150311326608061790466308593750e-01,
-8.8479709843093778953715400348301045596599578857421875e-01,
-8.8408125871263498751773113326635211706161499023437500e-01,
-8.8336333866573157891366463445592671632766723632812500e-01,
-8.8264333997956279098673348926240578293800354003906250e-01,
-8.8192126434835504955600526955095119774341583251953125e-01,
-8.8119711347122209321724994879332371056079864501953125e-01,
-8.8047088905216075449544632647302933037281036376953125e-01,
-8.7974259280004751815340569010004401206970214843750000e-01,
-8.7901222642863352518816100200638175010681152343750000e-01,
-8.7827979165654157522880041142343543469905853271484375e-01,
-8.7754529020726135257746136630885303020477294921875000e-01,
-8.7680872380914565145104688781430013477802276611328125e-01,
-8.7607009419540660122294184475322254002094268798828125e-01,
-8.7532940310411089246400706542772240936756134033203125e-01,
-8.7458665227817611320659807461197488009929656982421875e-01,
-8.7384184346536686316397890550433658063411712646484375e-01,
-8.7309497841829009079361867406987585127353668212890625e-01,
-8.7234605889439154058351277853944338858127593994140625e-01,
-8.7159508665595109011547947375220246613025665283203125e-01,
-8.7084206347007897530687614562339149415493011474609375e-01,
-8.7008699110871146054080327303381636738777160644531250e-01,
-8.6932987134860684186321577726630493998527526855468750e-01,
-8.6857070597134089506852205886389128863811492919921875e-01,
-8.6780949676330332298590519712888635694980621337890625e-01,
-8.6704624551569264845340967440279200673103332519531250e-01,
-8.6628095402451299467116996311233378946781158447265625e-01,
-8.6551362409056908919779971256502903997898101806640625e-01,
-8.6474425751946237816980556090129539370536804199218750e-01,
-8.6397285612158680745409355949959717690944671630859375e-01,
-8.6319942171212415971126574731897562742233276367187500e-01,
-8.6242395611104061270424381291377358138561248779296875e-01,
-8.6164646114308129920544843116658739745616912841796875e-01,
-8.6086693863776730939463277536560781300067901611328125e-01,
-8.6008539042939013974375939142191782593727111816406250e-01,
-8.5930181835700847337022878491552546620368957519531250e-01,
-8.5851622426444273994405875782831571996212005615234375e-01,
-8.5772861000027211808571792062139138579368591308593750e-01,
-8.5693897741782876220639764142106287181377410888671875e-01,
-8.5614732837519447183893817054922692477703094482421875e-01,
-8.5535366473519602870112521486589685082435607910156250e-01,
-8.5455798836540053375898651211173273622989654541015625e-01,
-8.5376030113811141042390318034449592232704162597656250e-01,
-8.5296060493036363059360382976592518389225006103515625e-01,
-8.5215890162391982887157837467384524643421173095703125e-01,
-8.5135519310526519554116475774208083748817443847656250e-01,
-8.5054948126560347976266029945691116154193878173828125e-01,
-8.4974176800085243765892073497525416314601898193359375e-01,
-8.4893205521163961346786663852981291711330413818359375e-01,
-8.4812034480329723251657014770898967981338500976562500e-01,
-8.4730663868585831544066877540899440646171569824218750e-01,
-8.4649093877405212626996444669202901422977447509765625e-01,
-8.4567324698729906540251022306620143353939056396484375e-01,
-8.4485356524970711689093150198459625244140625000000000e-01,
-8.4403189549006640834960535357822664082050323486328125e-01,
-8.4320823964184543619637679512379691004753112792968750e-01,
-8.4238259964318584760434305280796252191066741943359375e-01,
-8.4155497743689844369896491116378456354141235351562500e-01,
-8.4072537497045807253215343735064379870891571044921875e-01,
-8.3989379419599952125707886807504110038280487060546875e-01,
-8.3906023707031274216916472141747362911701202392578125e-01,
-8.3822470555483807874708190865931101143360137939453125e-01,
-8.3738720161566193578295269617228768765926361083984375e-01,
-8.3654772722351200542334481724537909030914306640625000e-01,
-8.3570628435375260423256804642733186483383178710937500e-01,
-8.3486287498638001025597077386919409036636352539062500e-01,
-8.3401750110601813315014396721380762755870819091796875e-01,
-8.3317016470191318511240297084441408514976501464843750e-01,
-8.3232086776792968407789885532110929489135742187500000e-01,
-8.3146961230254523567140267914510332047939300537109375e-01,
-8.3061640030884631435981191316386684775352478027343750e-01,
-8.2976123379452304540393470233539119362831115722656250e-01,
-8.2890411477186487498869382761768065392971038818359375e-01,
-8.2804504525775579626412081779562868177890777587890625e-01,
-8.2718402727366913129714021124527789652347564697265625e-01,
-8.2632106284566353426868090537027455866336822509765625e-01,
-8.2545615400437755138085549333482049405574798583984375e-01,
-8.2458930278502529098716422595316544175148010253906250e-01,
-8.2372051122739142758888419848517514765262603759765625e-01,
-8.2284978137582642787606346246320754289627075195312500e-01,
-8.2197711527924155472391021248768083751201629638671875e-01,
-8.2110251499110464834529921063221991062164306640625000e-01,
-8.2022598256943468619795112317660823464393615722656250e-01,
-8.1934752007679700902542663243366405367851257324218750e-01,
-8.1846712958029876894272547360742464661598205566406250e-01,
-8.1758481315158371138807069655740633606910705566406250e-01,
-8.1670057286682784525311262768809683620929718017578125e-01,
-8.1581441080673378074550328165059909224510192871093750e-01,
-8.1492632905652662156370524826343171298503875732421875e-01,
-8.1403632970594841378186856672982685267925262451171875e-01,
-8.1314441484925359393542976249591447412967681884765625e-01,
-8.1225058658520388199519857153063639998435974121093750e-01,
-8.1135484701706372945295697718393057584762573242187500e-01,
-8.1045719825259476820633608440402895212173461914062500e-01,
-8.0955764240405125864441515659564174711704254150390625e-01,
-8.0865618158817498262180833989987149834632873535156250e-01,
-8.0775281792619035847735631250543519854545593261718750e-01,
-8.0684755354379933400821300892857834696769714355468750e-01,
-8.0594039057117627944393234429298900067806243896484375e-01,
-8.0503133114296365757667217621929012238979339599609375e-01,
-8.0412037739826580651225640394841320812702178955078125e-01,
-8.0320753148064494286728631777805276215076446533203125e-01,
-8.0229279553811572167631993579561822116374969482421875e-01,
-8.0137617172314024038826119067380204796791076660156250e-01,
-8.0045766219262282081814419143483974039554595947265625e-01,
-7.9953726910790501314352241024607792496681213378906250e-01,
-7.9861499463476082194546279424685053527355194091796875e-01,
-7.9769084094339104407112017725012265145778656005859375e-01,
-7.9676481020841882774163877911632880568504333496093750e-01,
-7.9583690460888356632551676739240065217018127441406250e-01,
-7.9490712632823701255802006926387548446655273437500000e-01,
-7.9397547755433717231454693319392390549182891845703125e-01,
-7.9304196047944364167392450326588004827499389648437500e-01,
-7.9210657730021238887019308094750158488750457763671875e-01,
-7.9116933021769020317748299930826760828495025634765625e-01,
-7.9023022143731014299561365987756289541721343994140625e-01,
-7.8928925316888565166806301931501366198062896728515625e-01,
-7.8834642762660633863447401381563395261764526367187500e-01,
-7.8740174702903142911480927068623714148998260498046875e-01,
-7.8645521359908576730646245778189040720462799072265625e-01,
-7.8550682956405393220222777017625048756599426269531250e-01,
-7.8455659715557524158668911695713177323341369628906250e-01,
-7.8360451860963820092109699544380418956279754638671875e-01,
-7.8265059616657572938436260301386937499046325683593750e-01,
-7.8169483207105938671332978628925047814846038818359375e-01,
-7.8073722857209448822146669044741429388523101806640625e-01,
-7.7977778792301455368374263343866914510726928710937500e-01,
-7.7881651238147597826610990523477084934711456298828125e-01,
-7.7785340420945314754419541714014485478401184082031250e-01,
-7.7688846567323244229896772594656795263290405273437500e-01,
-7.7592169904340768660233607079135254025459289550781250e-01,
-7.7495310659487393056821247228072024881839752197265625e-01,
-7.7398269060682289843811076934798620641231536865234375e-01,
-7.7301045336273699337681364340824075043201446533203125e-01,
-7.7203639715038452351336673018522560596466064453125000e-01,
-7.7106052426181381775904810638166964054107666015625000e-01,
-7.7008283699334800775915255144354887306690216064453125e-01,
-7.6910333764557969882247334680869244039058685302734375e-01,
-7.6812202852336541880617915012408047914505004882812500e-01,
-7.6713891193582040006759825701010413467884063720703125e-01,
-7.6615399019631291732679301276220940053462982177734375e-01,
-7.6516726562245895859604161159950308501720428466796875e-01,
-7.6417874053611678508701743339770473539829254150390625e-01,
-7.6318841726338126907336345539079047739505767822265625e-01,
-7.6219629813457889788708143896656110882759094238281250e-01,
-7.6120238548426177871419895382132381200790405273437500e-01,
-7.6020668165120242054655363972415216267108917236328125e-01,
-7.5920918897838807204436761821852996945381164550781250e-01,
-7.5820990981301528144342682935530319809913635253906250e-01,
-7.5720884650648456748456283094128593802452087402343750e-01,
-7.5620600141439453523162228520959615707397460937500000e-01,
-7.5520137689653654700094875806826166808605194091796875e-01,
-7.5419497531688917124625959331751801073551177978515625e-01,
-7.5318679904361252042122032435145229101181030273437500e-01,
-7.5217685044904281088662401089095510542392730712890625e-01,
-7.5116513190968647872836072565405629575252532958984375e-01,
-7.5015164580621507273150427863583900034427642822265625e-01,
-7.4913639452345937019828170377877540886402130126953125e-01,
-7.4811938045040360378834520815871655941009521484375000e-01,
-7.4710060598018013244825397123349830508232116699218750e-01,
-7.4608007351006377927404855654458515346050262451171875e-01,
-7.4505778544146605835152286090306006371974945068359375e-01,
-7.4403374417992929057419360105996020138263702392578125e-01,
-7.4300795213512171866199196301749907433986663818359375e-01,
-7.4198041172083106786772077612113207578659057617187500e-01,
-7.4095112535495910588423384979250840842723846435546875e-01,
-7.3992009545951620275161531026242300868034362792968750e-01,
-7.3888732446061511360824169969419017434120178222656250e-01,
-7.3785281478846598268717116297921165823936462402343750e-01,
-7.3681656887736990402260062182904221117496490478515625e-01,
-7.3577858916571359237934757402399554848670959472656250e-01,
-7.3473887809596349907081958008348010480403900146484375e-01,
-7.3369743811466037186619359999895095825195312500000000e-01,
-7.3265427167241281569687316732597537338733673095703125e-01,
-7.3160938122389262971978496352676302194595336914062500e-01,
-7.3056276922782759086771875445265322923660278320312500e-01,
-7.2951443814699701295722888971795327961444854736328125e-01,
-7.2846439044822519637278901427634991705417633056640625e-01,
-7.2741262860237576592936648012255318462848663330078125e-01,
-7.2635915508434600873499675799394026398658752441406250e-01,
-7.2530397237306076796414799900958314538002014160156250e-01,
-7.2424708295146700276490037140320055186748504638671875e-01,
-7.2318848930652745998770569713087752461433410644531250e-01,
-7.2212819392921534511486925111967138946056365966796875e-01,
-7.2106619931450810501161186039098538458347320556640625e-01,
-7.2000250796138165476634185324655845761299133300781250e-01,
-7.1893712237280449350862454593880102038383483886718750e-01,
-7.1787004505573170920484926682547666132450103759765625e-01,
-7.1680127852109953856540869310265406966209411621093750e-01,
-7.1573082528381859468424863734981045126914978027343750e-01,
-7.1465868786276909307986215935670770704746246337890625e-01,
-7.1358486878079363524562950260587967932224273681640625e-01,
-7.1250937056469232366850974358385428786277770996093750e-01,
-7.1143219574521643355780042838887311518192291259765625e-01,
-7.1035334685706241764080459688557311892509460449218750e-01,
-7.0927282643886568891389288182836025953292846679687500e-01,
-7.0819063703319540259428777062566950917243957519531250e-01,
-7.0710678118654757273731092936941422522068023681640625e-01,
-7.0602126144933974316586500208359211683273315429687500e-01,
-7.0493408037590499226610063487896695733070373535156250e-01,
-7.0384524052448493858236133746686391532421112060546875e-01,
-7.0275474445722529992508498253300786018371582031250000e-01,
-7.0166259474016856589884127970435656607151031494140625e-01,
-7.0056879394324844678720864976639859378337860107421875e-01,
-6.9947334464028376732613878630218096077442169189453125e-01,
-6.9837624940897291558883352990960702300071716308593750e-01,
-6.9727751083088662653608480468392372131347656250000000e-01,
-6.9617713149146298601266380501328967511653900146484375e-01,
-6.9507511398000088043147570715518668293952941894531250e-01,
-6.9397146088965400156922669339110143482685089111328125e-01,
-6.9286617481742474033978851366555318236351013183593750e-01,
-6.9175925836415774750065565967815928161144256591796875e-01,
-6.9065071413453471560472962664789520204067230224609375e-01,
-6.8954054473706694050605392476427368819713592529296875e-01,
-6.8842875278409054740080819101422093808650970458984375e-01,
-6.8731534089175916335534566314890980720520019531250000e-01,
-6.8620031168003869925797744144801981747150421142578125e-01,
-6.8508366777270035541391735023353248834609985351562500e-01,
-6.8396541179731551451936866214964538812637329101562500e-01,
-6.8284554638524808112265418458264321088790893554687500e-01,
-6.8172407417164981868751283400342799723148345947265625e-01,
-6.8060099779545313314343957245000638067722320556640625e-01,
-6.7947631989936507768135243168217130005359649658203125e-01,
-6.7835004312986157959386446236749179661273956298828125e-01,
-6.7722217013718044587022859559510834515094757080078125e-01,
-6.7609270357531603412581944212433882057666778564453125e-01,
-6.7496164610201203615247322886716574430465698242187500e-01,
-6.7382900037875614884796959813684225082397460937500000e-01,
-6.7269476907077296878867400664603337645530700683593750e-01,
-6.7155895484701844111441459972411394119262695312500000e-01,
-6.7042156038017308716803199786227196455001831054687500e-01,
-6.6928258834663600929104632086819037795066833496093750e-01,
-6.6814204142651856255241682447376661002635955810546875e-01,
-6.6699992230363747136578922436456196010112762451171875e-01,
-6.6585623366550972246358242045971564948558807373046875e-01,
-6.6471097820334490435811858333181589841842651367187500e-01,
-6.6356415861203987827110495345550589263439178466796875e-01,
-6.6241577759017178372857870272127911448478698730468750e-01,
-6.6126583783999226540117888362146914005279541015625000e-01,
-6.6011434206742047869909129076404497027397155761718750e-01,
-6.5896129298203731661232041005860082805156707763671875e-01,
-6.5780669329707863735023920526145957410335540771484375e-01,
-6.5665054572942904709265121709904633462429046630859375e-01,
-6.5549285299961546069624773735995404422283172607421875e-01,
-6.5433361783180055137876252047135494649410247802734375e-01,
-6.5317284295377675551463880765368230640888214111328125e-01,
-6.5201053109695950027457911346573382616043090820312500e-01,
-6.5084668499638098637660732492804527282714843750000000e-01,
-6.4968130739068319368101356303668580949306488037109375e-01,
-6.4851440102211255211983598201186396181583404541015625e-01,
-6.4734596863651205911338593068649061024188995361328125e-01,
-6.4617601298331639458893960181740112602710723876953125e-01,
-6.4500453681554403839726319347391836345195770263671875e-01,
-6.4383154288979149715288485822384245693683624267578125e-01,
-6.4265703396622686494055187722551636397838592529296875e-01,
-6.4148101280858316197708290928858332335948944091796875e-01,
-6.4030348218415167327322023993474431335926055908203125e-01,
-6.3912444486377573138469188052113167941570281982421875e-01,
-6.3794390362184416609636627981672063469886779785156250e-01,
-6.3676186123628431001719718551612459123134613037109375e-01,
-6.3557832048855622542049559342558495700359344482421875e-01,
-6.3439328416364548779426968394545838236808776855468750e-01,
-6.3320675505005719063689184622489847242832183837890625e-01,
-6.3201873593980906207434600219130516052246093750000000e-01,
-6.3082922962842458147747493057977408170700073242187500e-01,
-6.2963823891492709527994975360343232750892639160156250e-01,
-6.2844576660183271155091233595157973468303680419921875e-01,
-6.2725181549514419376833984642871655523777008056640625e-01,
-6.2605638840434352232477976940572261810302734375000000e-01,
-6.2485948814238645443452924155280925333499908447265625e-01,
-6.2366111752569464155016021322808228433132171630859375e-01,
-6.2246127937415007824739632269483990967273712158203125e-01,
-6.2125997651108766373084790757275186479091644287109375e-01,
-6.2005721176328920662967902899254113435745239257812500e-01,
-6.1885298796097631957024987059412524104118347167968750e-01,
-6.1764730793780397988257391261868178844451904296875000e-01,
-6.1644017453085364621756525593809783458709716796875000e-01,
-6.1523159058062681925349579614703543484210968017578125e-01,
-6.1402155893103849138014993513934314250946044921875000e-01,
-6.1281008242940970820455959255923517048358917236328125e-01,
-6.1159716392646201743588108001858927309513092041015625e-01,
-6.1038280627630947527961779996985569596290588378906250e-01,
-6.0916701233645320634479958243900910019874572753906250e-01,
-6.0794978496777374310511277144541963934898376464843750e-01,
-6.0673112703452447558305493657826445996761322021484375e-01,
-6.0551104140432554512329943463555537164211273193359375e-01,
-6.0428953094815607283152303352835588157176971435546875e-01,
-6.0306659854034827539237539895111694931983947753906250e-01,
-6.0184224705858002657521410583285614848136901855468750e-01,
-6.0061647938386897305207412500749342143535614013671875e-01,
-5.9938929840056454079189052208676002919673919677734375e-01,
-5.9816070699634238394537533167749643325805664062500000e-01,
-5.9693070806219650226154271877021528780460357666015625e-01,
-5.9569930449243346792798092792509123682975769042968750e-01,
-5.9446649918466454298737744466052390635013580322265625e-01,
-5.9323229503979979515548848212347365915775299072265625e-01,
-5.9199669496204099239378138008760288357734680175781250e-01,
-5.9075970185887427543747207892010919749736785888671875e-01,
-5.8952131864106394054658721870509907603263854980468750e-01,
-5.8828154822264533407860653824172914028167724609375000e-01,
-5.8704039352091808012801266158930957317352294921875000e-01,
-5.8579785745643886407663103454979136586189270019531250e-01,
-5.8455394295301532636699448630679398775100708007812500e-01,
-5.8330865293769829094117085332982242107391357421875000e-01,
-5.8206199034077554799182507849764078855514526367187500e-01,
-5.8081395809576452649025668506510555744171142578125000e-01,
-5.7956455913940574387055448823957704007625579833984375e-01,
-5.7831379641165558957993653166340664029121398925781250e-01,
-5.7706167285567955271829987395904026925563812255859375e-01,
-5.7580819141784533865546791275846771895885467529296875e-01,
-5.7455335504771576360383278370136395096778869628906250e-01,
-5.7329716669804231532481253452715463936328887939453125e-01,
-5.7203962932475704850077136143227107822895050048828125e-01,
-5.7078074588696736668680387083441019058227539062500000e-01,
-5.6952051934694725154884054063586518168449401855468750e-01,
-5.6825895267013148970391966940951533615589141845703125e-01,
-5.6699604882510867831513223791262134909629821777343750e-01,
-5.6573181078361323148584460795973427593708038330078125e-01,
-5.6446624152051949607766800909303128719329833984375000e-01,
-5.6319934401383409117158862500218674540519714355468750e-01,
-5.6193112124468946877442476761643774807453155517578125e-01,
-5.6066157619733603123535203849314711987972259521484375e-01,
-5.5939071185913613604157035297248512506484985351562500e-01,
-5.5811853122055610221252663905033841729164123535156250e-01,
-5.5684503727516010407327939901733770966529846191406250e-01,
-5.5557023301960228867102387084742076694965362548828125e-01,
-5.5429412145362011443694427725858986377716064453125000e-01,
-5.5301670558002757882576361225801520049571990966796875e-01,
-5.5173798840470744675457126504625193774700164794921875e-01,
-5.5045797293660481130928019410930573940277099609375000e-01,
-5.4917666218771976627266440118546597659587860107421875e-01,
-5.4789405917310018967469886774779297411441802978515625e-01,
-5.4661016691083486040980687903356738388538360595703125e-01,
-5.4532498842204646383180488555808551609516143798828125e-01,
-5.4403852673088393121503258953453041613101959228515625e-01,
-5.4275078486451600046081011896603740751743316650390625e-01,
-5.4146176585312355555856811406556516885757446289062500e-01,
-5.4017147272989296524769997631665319204330444335937500e-01,
-5.3887990853100842247869195489329285919666290283203125e-01,
-5.3758707629564550511958032075199298560619354248046875e-01,
-5.3629297906596318235017406550468876957893371582031250e-01,
-5.3499761988709726434620961299515329301357269287109375e-01,
-5.3370100180715296378508583075017668306827545166015625e-01,
-5.3240312787719801246311135400901548564434051513671875e-01,
-5.3110400115125511177893713465891778469085693359375000e-01,
-5.2980362468629482730619884023326449096202850341796875e-01,
-5.2850200154222848336615925290971063077449798583984375e-01,
-5.2719913478190139066725805605528876185417175292968750e-01,
-5.2589502747108474167703207058366388082504272460937500e-01,
-5.2458968267846883826166504150023683905601501464843750e-01,
-5.2328310347565643034783988696290180087089538574218750e-01,
-5.2197529293715438925005400960799306631088256835937500e-01,
-5.2066625414036726837707647064235061407089233398437500e-01,
-5.1935599016558953167077561374753713607788085937500000e-01,
-5.1804450409599933635718116420321166515350341796875000e-01,
-5.1673179901764998422919461518176831305027008056640625e-01,
-5.1541787801946314928613901429343968629837036132812500e-01,
-5.1410274419322166128409890006878413259983062744140625e-01,
-5.1278640063356306644237747605075128376483917236328125e-01,
-5.1146885043797052361469468451105058193206787109375000e-01,
-5.1015009670676669806255176808917894959449768066406250e-01,
-5.0883014254310710011708351885317824780941009521484375e-01,
-5.0750899105297087032795388950034976005554199218750000e-01,
-5.0618664534515545039283779260586015880107879638671875e-01,
-5.0486310853126747932861917433911003172397613525390625e-01,
-5.0353838372571757542317527622799389064311981201171875e-01,
-5.0221247404571089933966732132830657064914703369140625e-01,
-5.0088538261124093686760261334711685776710510253906250e-01,
-4.9955711254508189389511585432046558707952499389648438e-01,
-4.9822766697278186853736769990064203739166259765625000e-01,
-4.9689704902265463548616253319778479635715484619140625e-01,
-4.9556526182577248507143963252019602805376052856445312e-01,
-4.9423230851595972845657911420857999473810195922851562e-01,
-4.9289819222978409340996108767285477370023727416992188e-01,
-4.9156291610655006296681790445290971547365188598632812e-01,
-4.9022648328829115937921301338064949959516525268554688e-01,
-4.8888889691976322726674197838292457163333892822265625e-01,
-4.8755016014843605143269655854965094476938247680664062e-01,
-4.8621027612448652899246326342108659446239471435546875e-01,
-4.8486924800079106434580467066552955657243728637695312e-01,
-4.8352707893291879681640921262442134320735931396484375e-01,
-4.8218377207912282988999663757567759603261947631835938e-01,
-4.8083933060033390294307764634140767157077789306640625e-01,
-4.7949375766015300825984013499692082405090332031250000e-01,
-4.7814705642484311987061573745450004935264587402343750e-01,
-4.7679923006332225465797591823502443730831146240234375e-01,
-4.7545028174715586732901329014566726982593536376953125e-01,
-4.7410021465055002254374016956717241555452346801757812e-01,
-4.7274903195034290170895019400632008910179138183593750e-01,
-4.7139673682599780857316318360972218215465545654296875e-01,
-4.7004333245959561971005769009934738278388977050781250e-01,
-4.6868882203582801215802078331762459129095077514648438e-01,
-4.6733320874198852612479981871729250997304916381835938e-01,
-4.6597649576796612569395961145346518605947494506835938e-01,
-4.6461868630623781584176867909263819456100463867187500e-01,
-4.6325978355186026025336332168080843985080718994140625e-01,
-4.6189979070246289793999494577292352914810180664062500e-01,
-4.6053871095824000514440399456361774355173110961914062e-01,
-4.5917654752194414502497465946362353861331939697265625e-01,
-4.5781330359887728587153787884744815528392791748046875e-01,
-4.5644898239688386221146743082499597221612930297851562e-01,
-4.5508358712634383591577602601319085806608200073242188e-01,
-4.5371712100016392543722076879930682480335235595703125e-01,
-4.5234958723377099998330663765955250710248947143554688e-01,
-4.5098098904510380835475302774284500628709793090820312e-01,
-4.4961132965460659516310215622070245444774627685546875e-01,
-4.4824061228521999700191713600361254066228866577148438e-01,
-4.4686884016237432559748299354396294802427291870117188e-01,
-4.4549601651398174073648306148243136703968048095703125e-01,
-4.4412214457042925586094384016178082674741744995117188e-01,
-4.4274722756457013383979415266367141157388687133789062e-01,
-4.4137126873171661500805385003332048654556274414062500e-01,
-4.3999427130963325582868606034026015549898147583007812e-01,
-4.3861623853852771404149279987905174493789672851562500e-01,
-4.3723717366104419834726968474569730460643768310546875e-01,
-4.3585707992225547480202862971054855734109878540039062e-01,
-4.3447596056965570587848901595862116664648056030273438e-01,
-4.3309381885315206828224177115771453827619552612304688e-01,
-4.3171065802505736996863561216741800308227539062500000e-01,
-4.3032648134008261164851205649028997868299484252929688e-01,
-4.2894129205532954829394043372303713113069534301757812e-01,
-4.2755509343028219593207950310898013412952423095703125e-01,
-4.2616788872679961519551739002054091542959213256835938e-01,
-4.2477968120910880589491398495738394558429718017578125e-01,
-4.2339047414379610279056009858322795480489730834960938e-01,
-4.2200027079979979260926370443485211580991744995117188e-01,
-4.2060907444840250901663125659979414194822311401367188e-01,
-4.1921688836322396065625639494101051241159439086914062e-01,
-4.1782371582021238243243033139151521027088165283203125e-01,
-4.1642956009763731906048178643686696887016296386718750e-01,
-4.1503442447608163146099968798807822167873382568359375e-01,
-4.1363831223843461337708049541106447577476501464843750e-01,
-4.1224122666988299856782873575866688042879104614257812e-01,
-4.1084317105790391089215063402662053704261779785156250e-01,
-4.0944414869225759234794281837821472436189651489257812e-01,
-4.0804416286497874333250024392327759414911270141601562e-01,
-4.0664321687036913965940243542718235403299331665039062e-01,
-4.0524131400498986099734111121506430208683013916015625e-01,
-4.0383845756765412993161135091213509440422058105468750e-01,
-4.0243465085941854120221705670701339840888977050781250e-01,
-4.0102989718357578974305965857638511806726455688476562e-01,
-3.9962419984564684360961450693139340728521347045898438e-01,
-3.9821756215337367201811957784229889512062072753906250e-01,
-3.9680998741671041907252970304398331791162490844726562e-01,
-3.9540147894781629833715896893409080803394317626953125e-01,
-3.9399204006104809883126449676638003438711166381835938e-01,
-3.9258167407295158080060559768753591924905776977539062e-01,
-3.9117038430225398171202755293052177876234054565429688e-01,
-3.8975817406985641122574293149227742105722427368164062e-01,
-3.8834504669882630167876413906924426555633544921875000e-01,
-3.8693100551438869283416011057852301746606826782226562e-01,
-3.8551605384391901543139624664036091417074203491210938e-01,
-3.8410019501693504206940588119323365390300750732421875e-01,
-3.8268343236508983729038391174981370568275451660156250e-01,
-3.8126576922216248721753117933985777199268341064453125e-01,
-3.7984720892405110514999933002400211989879608154296875e-01,
-3.7842775480876561511323075137624982744455337524414062e-01,
-3.7700741021641831496324925865337718278169631958007812e-01,
-3.7558617848921732607081480637134518474340438842773438e-01,
-3.7416406297145798909298264334211125969886779785156250e-01,
-3.7274106700951581405689694292959757149219512939453125e-01,
-3.7131719395183765408674503305519465357065200805664062e-01,
-3.6989244714893426690949240764894057065248489379882812e-01,
-3.6846682995337232124910542552242986857891082763671875e-01,
-3.6704034571976723588804247810912784188985824584960938e-01,
-3.6561299780477396481614960066508501768112182617187500e-01,
-3.6418478956707983629215164000925142318010330200195312e-01,
-3.6275572436739722537168972849030978977680206298828125e-01,
-3.6132580556845433905621689518739003688097000122070312e-01,
-3.5989503653498827739909415868169162422418594360351562e-01,
-3.5846342063373654029945214460894931107759475708007812e-01,
-3.5703096123343008860828717843105550855398178100585938e-01,
-3.5559766170478396274390320286329369992017745971679688e-01,
-3.5416352542049051033146156441944185644388198852539062e-01,
-3.5272855575521072646338893719075713306665420532226562e-01,
-3.5129275608556714827201972184411715716123580932617188e-01,
-3.4985612979013502865655027562752366065979003906250000e-01,
-3.4841868024943450921071530501649249345064163208007812e-01,
-3.4698041084592368132888395848567597568035125732421875e-01,
-3.4554132496398914931035051267826929688453674316406250e-01,
-3.4410142598993898044312800266197882592678070068359375e-01,
-3.4266071731199437833126353325496893376111984252929688e-01,
-3.4121920232028241093402698425052221864461898803710938e-01,
-3.3977688440682696224826031539123505353927612304687500e-01,
-3.3833376696554129381411257782019674777984619140625000e-01,
-3.3688985339222005110926261295389849692583084106445312e-01,
-3.3544514708453165852120037015993148088455200195312500e-01,
-3.3399965144200949307418113676249049603939056396484375e-01,
-3.3255336986604422389035562446224503219127655029296875e-01,
-3.3110630575987642920665621204534545540809631347656250e-01,
-3.2965846252858754805714625035761855542659759521484375e-01,
-3.2820984357909266382335999878705479204654693603515625e-01,
-3.2676045232013178898355931778496596962213516235351562e-01,
-3.2531029216226298172998099289543461054563522338867188e-01,
-3.2385936651785296458427865218254737555980682373046875e-01,
-3.2240767880107001897016516522853635251522064208984375e-01,
-3.2095523242787521445151810439710970968008041381835938e-01,
-3.1950203081601574739423199389420915395021438598632812e-01,
-3.1804807738501505998129914587480016052722930908203125e-01,
-3.1659337555616584580775452195666730403900146484375000e-01,
-3.1513792875252244485295705089811235666275024414062500e-01,
-3.1368174039889157311833400854084175080060958862304688e-01,
-3.1222481392182505066656972303462680429220199584960938e-01,
-3.1076715274961147494892088616325054317712783813476562e-01,
-3.0930876031226878231095156479568686336278915405273438e-01,
-3.0784964004153497763027758082898799329996109008789062e-01,
-3.0638979537086108440036014144425280392169952392578125e-01,
-3.0492922973540242947976253162778448313474655151367188e-01,
-3.0346794657201137113133881939575076103210449218750000e-01,
-3.0200594931922819519343192951055243611335754394531250e-01,
-3.0054324141727339902985249864286743104457855224609375e-01,
-2.9907982630804047508021881185413803905248641967773438e-01,
-2.9761570743508630743079379499249625951051712036132812e-01,
-2.9615088824362395536482495117525104433298110961914062e-01,
-2.9468537218051432668985967211483512073755264282226562e-01,
-2.9321916269425868373232901831215713173151016235351562e-01,
-2.9175226323498937297529209899948909878730773925781250e-01,
-2.9028467725446233105301985233381856232881546020507812e-01,
-2.8881640820604947972327636307454667985439300537109375e-01,
-2.8734745954472956652736570504202973097562789916992188e-01,
-2.8587783472708072629586695256875827908515930175781250e-01,
-2.8440753721127182140904210427834186702966690063476562e-01,
-2.8293657045705539188062971334147732704877853393554688e-01,
-2.8146493792575805192868187987187411636114120483398438e-01,
-2.7999264308027338454820664992439560592174530029296875e-01,
-2.7851968938505305972697101424273569136857986450195312e-01,
-2.7704608030609995106274823228886816650629043579101562e-01,
-2.7557181931095825477839866834983695298433303833007812e-01,
-2.7409690986870632878336095927807036787271499633789062e-01,
-2.7262135544994897662363086965342517942190170288085938e-01,
-2.7114515952680806609720320921042002737522125244140625e-01,
-2.6966832557291520178210930680506862699985504150390625e-01,
-2.6819085706340317631912739670951850712299346923828125e-01,
-2.6671275747489842089521516754757612943649291992187500e-01,
-2.6523403028551190141470783601107541471719741821289062e-01,
-2.6375467897483151347159946453757584095001220703125000e-01,
-2.6227470702391358914340457886282820254564285278320312e-01,
-2.6079411791527556951919564198760781437158584594726562e-01,
-2.5931291513288634575928881531581282615661621093750000e-01,
-2.5783110216215893162328143262129742652177810668945312e-01,
-2.5634868248994291395348454898339696228504180908203125e-01,
-2.5486565960451462720115500815154518932104110717773438e-01,
-2.5338203699557027004374276657472364604473114013671875e-01,
-2.5189781815421691257839142963348422199487686157226562e-01,
-2.5041300657296527987227818812243640422821044921875000e-01,
-2.4892760574572025955575327316182665526866912841796875e-01,
-2.4744161916777343557249935201980406418442726135253906e-01,
-2.4595505033579459497339314566488610580563545227050781e-01,
-2.4446790274782420615551359333039727061986923217773438e-01,
-2.4298017990326398196643253868387546390295028686523438e-01,
-2.4149188530286930243207166313368361443281173706054688e-01,
-2.4000302244874149870668134099105373024940490722656250e-01,
-2.3851359484431849944385817252623382955789566040039062e-01,
-2.3702360599436733679112876416184008121490478515625000e-01,
-2.3553305940497545889478203662292798981070518493652344e-01,
-2.3404195858354345793905793016165262088179588317871094e-01,
-2.3255030703877532793910631880862638354301452636718750e-01,
-2.3105810828067127604690256248431978747248649597167969e-01,
-2.2956536582051886852262612137565156444907188415527344e-01,
-2.2807208317088578652942487678956240415573120117187500e-01,
-2.2657826384561011168194966103328624740242958068847656e-01,
-2.2508391135979277652978680634987540543079376220703125e-01,
-2.2358902922979001504089069385372567921876907348632812e-01,
-2.2209362097320359263896705215302063152194023132324219e-01,
-2.2059769010887364526496412509004585444927215576171875e-01,
-2.1910124015686976983730005485995206981897354125976562e-01,
-2.1760427463848366902432474034867482259869575500488281e-01,
-2.1610679707621960332630806078668683767318725585937500e-01,
-2.1460881099378692482559927157126367092132568359375000e-01,
-2.1311031991609136193588369678764138370752334594726562e-01,
-2.1161132736922760866349335628910921514034271240234375e-01,
-2.1011183688046972117824395809293491765856742858886719e-01,
-2.0861185197826345727456498480023583397269248962402344e-01,
-2.0711137619221856032147854875802295282483100891113281e-01,
-2.0561041305309932236689007822860730811953544616699219e-01,
-2.0410896609281700686544525069621158763766288757324219e-01,
-2.0260703884442110567221106975921429693698883056640625e-01,
-2.0110463484209195605956210783915594220161437988281250e-01,
-1.9960175762113105402129065168992383405566215515136719e-01,
-1.9809841071795372680064417636458529159426689147949219e-01,
-1.9659459767008022335055272833415074273943901062011719e-01,
-1.9509032201612833135051516819657990708947181701660156e-01,
-1.9358558729580374602186054744379362091422080993652344e-01,
-1.9208039704989238183330257925263140350580215454101562e-01,
-1.9057475482025279522879657179146306589245796203613281e-01,
-1.8906866414980627588704464869806542992591857910156250e-01,
-1.8756212858252974129413814807776361703872680664062500e-01,
-1.8605515166344663291475569621979957446455955505371094e-01,
-1.8454773693861964423135191282199230045080184936523438e-01,
-1.8303988795514106180384317212883615866303443908691406e-01,
-1.8153160826112513248631330498028546571731567382812500e-01,
-1.8002290140569951470972398510639322921633720397949219e-01,
-1.7851377093899759018746919991826871410012245178222656e-01,
-1.7700422041214886048621224290400277823209762573242188e-01,
-1.7549425337727139750931826256419299170374870300292969e-01,
-1.7398387338746384989107696128485258668661117553710938e-01,
-1.7247308399679603385656889713573036715388298034667969e-01,
-1.7096188876030135594952241717692231759428977966308594e-01,
-1.6945029123396793124811665620654821395874023437500000e-01,
-1.6793829497473122813744339509867131710052490234375000e-01,
-1.6642590354046421508016351253900211304426193237304688e-01,
-1.6491312048997008865569569024955853819847106933593750e-01,
-1.6339994938297322524256571796286152675747871398925781e-01,
-1.6188639378011190905759519864659523591399192810058594e-01,
-1.6037245724292839565983115335257025435566902160644531e-01,
-1.5885814333386139018955418578116223216056823730468750e-01,
-1.5734345561623827580710610618552891537547111511230469e-01,
-1.5582839765426531597469761436514090746641159057617188e-01,
-1.5431297301302024371771892674587434157729148864746094e-01,
-1.5279718525844340759611839075660100206732749938964844e-01,
-1.5128103795733024994341064939362695440649986267089844e-01,
-1.4976453467732162017078678672987734898924827575683594e-01,
-1.4824767898689619749497126122150802984833717346191406e-01,
-1.4673047445536174793190298260014969855546951293945312e-01,
-1.4521292465284751926901662955060601234436035156250000e-01,
-1.4369503315029458212492841084895189851522445678710938e-01,
-1.4217680351944800287711245800892356783151626586914062e-01,
-1.4065823933284923863418214295961661264300346374511719e-01,
-1.3913934416382628400654652978118974715471267700195312e-01,
-1.3762012158648617710099415489821694791316986083984375e-01,
-1.3610057517570620100322287271410459652543067932128906e-01,
-1.3458070850712622323896994203096255660057067871093750e-01,
-1.3306052515713917561157586533227004110813140869140625e-01,
-1.3154002870288328264081201268709264695644378662109375e-01,
-1.3001922272223334631213731427124002948403358459472656e-01,
-1.2849811079379322431570642493170453235507011413574219e-01,
-1.2697669649688597681702617592236492782831192016601562e-01,
-1.2545498341154620591808566132385749369859695434570312e-01,
-1.2393297511851220082945701506105251610279083251953125e-01,
-1.2241067519921627892998117204115260392427444458007812e-01,
-1.2088808723577722237241260927476105280220508575439453e-01,
-1.1936521481099135466585892118018819019198417663574219e-01,
-1.1784206150832501891478898414789000526070594787597656e-01,
-1.1631863091190487724535529423519619740545749664306641e-01,
-1.1479492660651025026652405358618125319480895996093750e-01,
-1.1327095217756436018596843950945185497403144836425781e-01,
-1.1174671121112665639341088308356120251119136810302734e-01,
-1.1022220729388318427588444592402083799242973327636719e-01,
-1.0869744401313867487868236594295012764632701873779297e-01,
-1.0717242495680887048870033595449058338999748229980469e-01,
-1.0564715371341069916066857103942311368882656097412109e-01,
-1.0412163387205472520058435748069314286112785339355469e-01,
-1.0259586902243628125930285932554397732019424438476562e-01,
-1.0106986275482787718260624387767165899276733398437500e-01,
-9.9543618660069443926374788134125992655754089355468750e-02,
-9.8017140329560770162231619906378909945487976074218750e-02,
-9.6490431355252606615557908753544325008988380432128906e-02,
-9.4963495329639061037774183660076232627034187316894531e-02,
-9.3436335845747911510450478544953512027859687805175781e-02,
-9.1908956497132696106255878021329408511519432067871094e-02,
-9.0381360877865010716725180373032344505190849304199219e-02,
-8.8853552582524683578490964919183170422911643981933594e-02,
-8.7325535206192225756716140949720283970236778259277344e-02,
-8.5797312344439879971957907400792464613914489746093750e-02,
-8.4268887593324126594751533048111014068126678466796875e-02,
-8.2740264549375802660691192613739985972642898559570312e-02,
-8.1211446809592385820408821928140241652727127075195312e-02,
-7.9682437971430125633887087133189197629690170288085938e-02,
-7.8153241632794315241206106747995363548398017883300781e-02,
-7.6623861392031616945885730274312663823366165161132812e-02,
-7.5094300847921291452990999459871090948581695556640625e-02,
-7.3564563599667454063535387831507250666618347167968750e-02,
-7.2034653246889415734166561833262676373124122619628906e-02,
-7.0504573389614008660508659431798150762915611267089844e-02,
-6.8974327628266732248540904492983827367424964904785156e-02,
-6.7443919563664106453515501016227062791585922241210938e-02,
-6.5913352797003929572916547385830199345946311950683594e-02,
-6.4382630929857409540773005574010312557220458984375000e-02,
-6.2851757564161420122061940674029756337404251098632812e-02,
-6.1320736302208647683364972635899903252720832824707031e-02,
-5.9789570746640006981831305665764375589787960052490234e-02,
-5.8258264500435731625405111344662145711481571197509766e-02,
-5.6726821166907782922894654120682389475405216217041016e-02,
-5.5195244349690031349098262580810114741325378417968750e-02,
-5.3663537652730679272661262757537770085036754608154297e-02,
-5.2131704680283316721833841711486456915736198425292969e-02,
-5.0599749036899337173434076930789160542190074920654297e-02,
-4.9067674327418125956867811510164756327867507934570312e-02,
-4.7535484156959260937380662426221533678472042083740234e-02,
-4.6003182130914643810370989740476943552494049072265625e-02,
-4.4470771854938744016561003036258625797927379608154297e-02,
-4.2938256934940959019808559560260619036853313446044922e-02,
-4.1405640977076711706228451248534838669002056121826172e-02,
-3.9872927587739845356473722404189174994826316833496094e-02,
-3.8340120373552791233073833154776366427540779113769531e-02,
-3.6807222941358991308291592758905608206987380981445312e-02,
-3.5274238898213947090987119281635386869311332702636719e-02,
-3.3741171851377642354474772901085088960826396942138672e-02,
-3.2208025408304703784967415458595496602356433868408203e-02,
-3.0674803176636580848146707012347178533673286437988281e-02,
-2.9141508764193739533521210205435636453330516815185547e-02,
-2.7608145778965819533423697862417611759155988693237305e-02,
-2.6074717829104039623633326527851750142872333526611328e-02,
-2.4541228522912263837474355909762380179017782211303711e-02,
-2.3007681468839410315885274371794366743415594100952148e-02,
-2.1474080275469605016969154576145228929817676544189453e-02,
-1.9940428551514597504956682882948371116071939468383789e-02,
-1.8406729905804820185410974886508483905345201492309570e-02,
-1.6872987947281772869168037232157075777649879455566406e-02,
-1.5339206284988219849974022679361951304599642753601074e-02,
-1.3805388528060348954373814933660469250753521919250488e-02,
-1.2271538285719944469387421293049555970355868339538574e-02,
-1.0737659167264572077082895873445522738620638847351074e-02,
-9.2037547820599599490698494719254085794091224670410156e-03,
-7.6698287395310770636625008478404197376221418380737305e-03,
-6.1358846491545151677349245744608197128400206565856934e-03,
-4.6019261204486719765704982876286521786823868751525879e-03,
-3.0679567629661379062067094736221406492404639720916748e-03,
-1.5339801862847661506616958604354294948279857635498047e-03,
-6.1232339957367660358688201472919830231284606233879003e-17,
--1.5339801862846436358162049984343866526614874601364136e-03,
--3.0679567629660156082016531087219846085645258426666260e-03,
--4.6019261204485496785654419227284961380064487457275391e-03,
--6.1358846491543928697298682095606636721640825271606445e-03,
--7.6698287395309547656574444829402636969462037086486816e-03,
--9.2037547820598367837030551186217053327709436416625977e-03,
--1.0737659167264448911716101520141819491982460021972656e-02,
--1.2271538285719823038744102916552947135642170906066895e-02,
--1.3805388528060225789007020580356766004115343093872070e-02,
--1.5339206284988098419330704302865342469885945320129395e-02,
--1.6872987947281651438524718855660466942936182022094727e-02,
--1.8406729905804695285320704556397686246782541275024414e-02,
--1.9940428551514476074313364506451762281358242034912109e-02,
--2.1474080275469483586325836199648620095103979110717773e-02,
--2.3007681468839288885241955995297757908701896667480469e-02,
--2.4541228522912142406831037533265771344304084777832031e-02,
--2.6074717829103914723543056197740952484309673309326172e-02,
--2.7608145778965698102780379485921002924442291259765625e-02,
--2.9141508764193618102877891828939027618616819381713867e-02,
--3.0674803176636459417503388635850569698959589004516602e-02,
--3.2208025408304578884877145128484698943793773651123047e-02,
--3.3741171851377517454384502570974291302263736724853516e-02,
--3.5274238898213822190896848951524589210748672485351562e-02,
--3.6807222941358866408201322428794810548424720764160156e-02,
--3.8340120373552666332983562824665568768978118896484375e-02,
--3.9872927587739727395277355981306754983961582183837891e-02,
--4.1405640977076593745032084825652418658137321472167969e-02,
--4.2938256934940834119718289230149821378290653228759766e-02,
--4.4470771854938619116470732706147828139364719390869141e-02,
--4.6003182130914518910280719410366145893931388854980469e-02,
--4.7535484156959136037290392096110736019909381866455078e-02,
--4.9067674327418007995671445087282336317002773284912109e-02,
--5.0599749036899212273343806600678362883627414703369141e-02,
--5.2131704680283191821743571381375659257173538208007812e-02,
--5.3663537652730554372570992427426972426474094390869141e-02,
--5.5195244349689913387901896157927694730460643768310547e-02,
--5.6726821166907658022804383790571591816842555999755859e-02,
--5.8258264500435606725314841014551348052918910980224609e-02,
--5.9789570746639882081741035335653577931225299835205078e-02,
--6.1320736302208529722168606213017483241856098175048828e-02,
--6.2851757564161309099759478158375713974237442016601562e-02,
--6.4382630929857284640682735243899514898657798767089844e-02,
--6.5913352797003804672826277055719401687383651733398438e-02,
--6.7443919563663981553425230686116265133023262023925781e-02,
--6.8974327628266607348450634162873029708862304687500000e-02,
--7.0504573389613897638206196916144108399748802185058594e-02,
--7.2034653246889290834076291503151878714561462402343750e-02,
--7.3564563599667329163445117501396453008055686950683594e-02,
--7.5094300847921166552900729129760293290019035339355469e-02,
--7.6623861392031505923583267758658621460199356079101562e-02,
--7.8153241632794190341115836417884565889835357666015625e-02,
--7.9682437971430014611584624617535155266523361206054688e-02,
--8.1211446809592260920318551598029443994164466857910156e-02,
--8.2740264549375677760600922283629188314080238342285156e-02,
--8.4268887593324001694661262718000216409564018249511719e-02,
--8.5797312344439755071867637070681666955351829528808594e-02,
--8.7325535206192100856625870619609486311674118041992188e-02,
--8.8853552582524558678400694589072372764348983764648438e-02,
--9.0381360877864885816634910042921546846628189086914062e-02,
--9.1908956497132571206165607691218610852956771850585938e-02,
--9.3436335845747786610360208214842714369297027587890625e-02,
--9.4963495329638950015471721144422190263867378234863281e-02,
--9.6490431355252481715467638423433527350425720214843750e-02,
--9.8017140329560645262141349576268112286925315856933594e-02,
--9.9543618660069319026284517804015194997191429138183594e-02,
--1.0106986275482775228251597354756086133420467376708984e-01,
--1.0259586902243615635921258899543317966163158416748047e-01,
--1.0412163387205460030049408715058234520256519317626953e-01,
--1.0564715371341057426057830070931231603026390075683594e-01,
--1.0717242495680875946639787343883654102683067321777344e-01,
--1.0869744401313856385637990342729608528316020965576172e-01,
--1.1022220729388305937579417559391004033386707305908203e-01,
--1.1174671121112654537110842056790716014802455902099609e-01,
--1.1327095217756423528587816917934105731546878814697266e-01,
--1.1479492660651012536643378325607045553624629974365234e-01,
--1.1631863091190475234526502390508539974689483642578125e-01,
--1.1784206150832489401469871381777920760214328765869141e-01,
--1.1936521481099122976576865085007739253342151641845703e-01,
--1.2088808723577709747232233894465025514364242553710938e-01,
--1.2241067519921615402989090171104180626571178436279297e-01,
--1.2393297511851207592936674473094171844422817230224609e-01,
--1.2545498341154606714020758317928994074463844299316406e-01,
--1.2697669649688586579472371340671088546514511108398438e-01,
--1.2849811079379311329340396241605048999190330505371094e-01,
--1.3001922272223323528983485175558598712086677551269531e-01,
--1.3154002870288314386293393454252509400248527526855469e-01,
--1.3306052515713903683369778718770248815417289733886719e-01,
--1.3458070850712611221666747951530851423740386962890625e-01,
--1.3610057517570606222534479456953704357147216796875000e-01,
--1.3762012158648606607869169238256290555000305175781250e-01,
--1.3913934416382617298424406726553570479154586791992188e-01,
--1.4065823933284912761187968044396257027983665466308594e-01,
--1.4217680351944789185480999549326952546834945678710938e-01,
--1.4369503315029444334705033270438434556126594543457031e-01,
--1.4521292465284740824671416703495196998119354248046875e-01,
--1.4673047445536163690960052008449565619230270385742188e-01,
--1.4824767898689608647266879870585398748517036437988281e-01,
--1.4976453467732150914848432421422330662608146667480469e-01,
--1.5128103795733013892110818687797291204333305358886719e-01,
--1.5279718525844329657381592824094695970416069030761719e-01,
--1.5431297301302013269541646423022029921412467956542969e-01,
--1.5582839765426520495239515184948686510324478149414062e-01,
--1.5734345561623816478480364366987487301230430603027344e-01,
--1.5885814333386127916725172326550818979740142822265625e-01,
--1.6037245724292825688195307520800270140171051025390625e-01,
--1.6188639378011177027971712050202768296003341674804688e-01,
--1.6339994938297311422026325544720748439431190490722656e-01,
--1.6491312048996994987781761210499098524451255798339844e-01,
--1.6642590354046410405786105002334807068109512329101562e-01,
--1.6793829497473108935956531695410376414656639099121094e-01,
--1.6945029123396782022581419369089417159557342529296875e-01,
--1.7096188876030124492721995466126827523112297058105469e-01,
--1.7247308399679592283426643462007632479071617126464844e-01,
--1.7398387338746371111319888314028503373265266418457031e-01,
--1.7549425337727125873144018441962543874979019165039062e-01,
--1.7700422041214874946390978038834873586893081665039062e-01,
--1.7851377093899745140959112177370116114616394042968750e-01,
--1.8002290140569940368742152259073918685317039489746094e-01,
--1.8153160826112502146401084246463142335414886474609375e-01,
--1.8303988795514092302596509398426860570907592773437500e-01,
--1.8454773693861953320904945030633825808763504028320312e-01,
--1.8605515166344649413687761807523202151060104370117188e-01,
--1.8756212858252960251626006993319606408476829528808594e-01,
--1.8906866414980616486474218618241138756275177001953125e-01,
--1.9057475482025265645091849364689551293849945068359375e-01,
--1.9208039704989227081100011673697736114263534545898438e-01,
--1.9358558729580360724398246929922606796026229858398438e-01,
--1.9509032201612819257263709005201235413551330566406250e-01,
--1.9659459767008011232825026581849670037627220153808594e-01,
--1.9809841071795361577834171384893124923110008239746094e-01,
--1.9960175762113094299898818917426979169249534606933594e-01,
--2.0110463484209181728168402969458838924765586853027344e-01,
--2.0260703884442096689433299161464674398303031921386719e-01,
--2.0410896609281689584314278818055754527449607849121094e-01,
--2.0561041305309921134458761571295326575636863708496094e-01,
--2.0711137619221844929917608624236891046166419982910156e-01,
--2.0861185197826331849668690665566828101873397827148438e-01,
--2.1011183688046961015594149557728087529540061950683594e-01,
--2.1161132736922749764119089377345517277717590332031250e-01,
--2.1311031991609125091358123427198734134435653686523438e-01,
--2.1460881099378681380329680905560962855815887451171875e-01,
--2.1610679707621949230400559827103279531002044677734375e-01,
--2.1760427463848355800202227783302078023552894592285156e-01,
--2.1910124015686965881499759234429802745580673217773438e-01,
--2.2059769010887353424266166257439181208610534667968750e-01,
--2.2209362097320348161666458963736658915877342224121094e-01,
--2.2358902922978987626301261570915812626481056213378906e-01,
--2.2508391135979266550748434383422136306762695312500000e-01,
--2.2657826384561000065964719851763220503926277160644531e-01,
--2.2807208317088567550712241427390836179256439208984375e-01,
--2.2956536582051875750032365885999752208590507507324219e-01,
--2.3105810828067113726902448433975223451852798461914062e-01,
--2.3255030703877521691680385629297234117984771728515625e-01,
--2.3404195858354331916117985201708506792783737182617188e-01,
--2.3553305940497534787247957410727394744753837585449219e-01,
--2.3702360599436722576882630164618603885173797607421875e-01,
--2.3851359484431838842155571001057978719472885131835938e-01,
--2.4000302244874138768437887847539968788623809814453125e-01,
--2.4149188530286916365419358498911606147885322570800781e-01,
--2.4298017990326387094413007616822142153978347778320312e-01,
--2.4446790274782409513321113081474322825670242309570312e-01,
--2.4595505033579448395109068314923206344246864318847656e-01,
--2.4744161916777332455019688950415002182126045227050781e-01,
--2.4892760574572012077787519501725910231471061706542969e-01,
--2.5041300657296516884997572560678236186504364013671875e-01,
--2.5189781815421680155608896711783017963171005249023438e-01,
--2.5338203699557015902144030405906960368156433105468750e-01,
--2.5486565960451451617885254563589114695787429809570312e-01,
--2.5634868248994280293118208646774291992187500000000000e-01,
--2.5783110216215882060097897010564338415861129760742188e-01,
--2.5931291513288623473698635280015878379344940185546875e-01,
--2.6079411791527545849689317947195377200841903686523438e-01,
--2.6227470702391347812110211634717416018247604370117188e-01,
--2.6375467897483140244929700202192179858684539794921875e-01,
--2.6523403028551179039240537349542137235403060913085938e-01,
--2.6671275747489830987291270503192208707332611083984375e-01,
--2.6819085706340300978567370293603744357824325561523438e-01,
--2.6966832557291509075980684428941458463668823242187500e-01,
--2.7114515952680795507490074669476598501205444335937500e-01,
--2.7262135544994886560132840713777113705873489379882812e-01,
--2.7409690986870621776105849676241632550954818725585938e-01,
--2.7557181931095814375609620583418291062116622924804688e-01,
--2.7704608030609984004044576977321412414312362670898438e-01,
--2.7851968938505294870466855172708164900541305541992188e-01,
--2.7999264308027327352590418740874156355857849121093750e-01,
--2.8146493792575794090637941735622007399797439575195312e-01,
--2.8293657045705528085832725082582328468561172485351562e-01,
--2.8440753721127171038673964176268782466650009155273438e-01,
--2.8587783472708061527356449005310423672199249267578125e-01,
--2.8734745954472945550506324252637568861246109008789062e-01,
--2.8881640820604936870097390055889263749122619628906250e-01,
--2.9028467725446222003071738981816451996564865112304688e-01,
--2.9175226323498926195298963648383505642414093017578125e-01,
--2.9321916269425857271002655579650308936834335327148438e-01,
--2.9468537218051421566755720959918107837438583374023438e-01,
--2.9615088824362384434252248865959700196981430053710938e-01,
--2.9761570743508619640849133247684221714735031127929688e-01,
--2.9907982630804036405791634933848399668931961059570312e-01,
--3.0054324141727328800755003612721338868141174316406250e-01,
--3.0200594931922808417112946699489839375019073486328125e-01,
--3.0346794657201126010903635688009671866893768310546875e-01,
--3.0492922973540226294630883785430341958999633789062500e-01,
--3.0638979537086097337805767892859876155853271484375000e-01,
--3.0784964004153486660797511831333395093679428100585938e-01,
--3.0930876031226867128864910228003282099962234497070312e-01,
--3.1076715274961136392661842364759650081396102905273438e-01,
--3.1222481392182493964426726051897276192903518676757812e-01,
--3.1368174039889140658488031476736068725585937500000000e-01,
--3.1513792875252233383065458838245831429958343505859375e-01,
--3.1659337555616573478545205944101326167583465576171875e-01,
--3.1804807738501494895899668335914611816406250000000000e-01,
--3.1950203081601563637192953137855511158704757690429688e-01,
--3.2095523242787510342921564188145566731691360473632812e-01,
--3.2240767880106985243671147145505528897047042846679688e-01,
--3.2385936651785285356197618966689333319664001464843750e-01,
--3.2531029216226287070767853037978056818246841430664062e-01,
--3.2676045232013167796125685526931192725896835327148438e-01,
--3.2820984357909255280105753627140074968338012695312500e-01,
--3.2965846252858743703484378784196451306343078613281250e-01,
--3.3110630575987631818435374952969141304492950439453125e-01,
--3.3255336986604411286805316194659098982810974121093750e-01,
--3.3399965144200938205187867424683645367622375488281250e-01,
--3.3544514708453154749889790764427743852138519287109375e-01,
--3.3688985339221994008696015043824445456266403198242188e-01,
--3.3833376696554118279181011530454270541667938232421875e-01,
--3.3977688440682685122595785287558101117610931396484375e-01,
--3.4121920232028229991172452173486817628145217895507812e-01,
--3.4266071731199426730896107073931489139795303344726562e-01,
--3.4410142598993886942082554014632478356361389160156250e-01,
--3.4554132496398903828804805016261525452136993408203125e-01,
--3.4698041084592357030658149597002193331718444824218750e-01,
--3.4841868024943439818841284250083845108747482299804688e-01,
--3.4985612979013491763424781311186961829662322998046875e-01,
--3.5129275608556703724971725932846311479806900024414062e-01,
--3.5272855575521061544108647467510309070348739624023438e-01,
--3.5416352542049039930915910190378781408071517944335938e-01,
--3.5559766170478385172160074034763965755701065063476562e-01,
--3.5703096123342992207483348465757444500923156738281250e-01,
--3.5846342063373642927714968209329526871442794799804688e-01,
--3.5989503653498816637679169616603758186101913452148438e-01,
--3.6132580556845422803391443267173599451780319213867188e-01,
--3.6275572436739711434938726597465574741363525390625000e-01,
--3.6418478956707972526984917749359738081693649291992188e-01,
--3.6561299780477385379384713814943097531795501708984375e-01,
--3.6704034571976712486574001559347379952669143676757812e-01,
--3.6846682995337221022680296300677582621574401855468750e-01,
--3.6989244714893415588718994513328652828931808471679688e-01,
--3.7131719395183748755329133928171359002590179443359375e-01,
--3.7274106700951570303459448041394352912902832031250000e-01,
--3.7416406297145787807068018082645721733570098876953125e-01,
--3.7558617848921721504851234385569114238023757934570312e-01,
--3.7700741021641820394094679613772314041852951049804688e-01,
--3.7842775480876550409092828886059578508138656616210938e-01,
--3.7984720892405099412769686750834807753562927246093750e-01,
--3.8126576922216237619522871682420372962951660156250000e-01,
--3.8268343236508972626808144923415966331958770751953125e-01,
--3.8410019501693493104710341867757961153984069824218750e-01,
--3.8551605384391890440909378412470687180757522583007812e-01,
--3.8693100551438858181185764806286897510290145874023438e-01,
--3.8834504669882619065646167655359022319316864013671875e-01,
--3.8975817406985630020344046897662337869405746459960938e-01,
--3.9117038430225387068972509041486773639917373657226562e-01,
--3.9258167407295141426715190391405485570430755615234375e-01,
--3.9399204006104798780896203425072599202394485473632812e-01,
--3.9540147894781618731485650641843676567077636718750000e-01,
--3.9680998741671030805022724052832927554845809936523438e-01,
--3.9821756215337350548466588406881783157587051391601562e-01,
--3.9962419984564667707616081315791234374046325683593750e-01,
--4.0102989718357567872075719606073107570409774780273438e-01,
--4.0243465085941843017991459419135935604572296142578125e-01,
--4.0383845756765401890930888839648105204105377197265625e-01,
--4.0524131400498974997503864869941025972366333007812500e-01,
--4.0664321687036902863709997291152831166982650756835938e-01,
--4.0804416286497863231019778140762355178594589233398438e-01,
--4.0944414869225748132564035586256068199872970581054688e-01,
--4.1084317105790379986984817151096649467945098876953125e-01,
--4.1224122666988288754552627324301283806562423706054688e-01,
--4.1363831223843450235477803289541043341159820556640625e-01,
--4.1503442447608152043869722547242417931556701660156250e-01,
--4.1642956009763698599357439888990484178066253662109375e-01,
--4.1782371582021227141012786887586116790771484375000000e-01,
--4.1921688836322407167855885745666455477476119995117188e-01,
--4.2060907444840239799432879408414009958505630493164062e-01,
--4.2200027079979968158696124191919807344675064086914062e-01,
--4.2339047414379576972365271103626582771539688110351562e-01,
--4.2477968120910875038376275369955692440271377563476562e-01,
--4.2616788872679967070666862127836793661117553710937500e-01,
--4.2755509343028186286517211556201800704002380371093750e-01,
--4.2894129205532943727163797120738308876752853393554688e-01,
--4.3032648134008272267081451900594402104616165161132812e-01,
--4.3171065802505709241287945587828289717435836791992188e-01,
--4.3309381885315195725993930864206049591302871704101562e-01,
--4.3447596056965581690079147847427520900964736938476562e-01,
--4.3585707992225536377972616719489451497793197631835938e-01,
--4.3723717366104408732496722223004326224327087402343750e-01,
--4.3861623853852738097458541233208961784839630126953125e-01,
--4.3999427130963314480638359782460611313581466674804688e-01,
--4.4137126873171672603035631254897452890872955322265625e-01,
--4.4274722756456980077288676511670928448438644409179688e-01,
--4.4412214457042914483864137764612678438425064086914062e-01,
--4.4549601651398179624763429274025838822126388549804688e-01,
--4.4686884016237399253057560599700082093477249145507812e-01,
--4.4824061228521988597961467348795849829912185668945312e-01,
--4.4961132965460670618540461873635649681091308593750000e-01,
--4.5098098904510369733245056522719096392393112182617188e-01,
--4.5234958723377088896100417514389846473932266235351562e-01,
--4.5371712100016364788146461251017171889543533325195312e-01,
--4.5508358712634372489347356349753681570291519165039062e-01,
--4.5644898239688397323376989334065001457929611206054688e-01,
--4.5781330359887700831578172255831304937601089477539062e-01,
--4.5917654752194403400267219694796949625015258789062500e-01,
--4.6053871095824011616670645707927178591489791870117188e-01,
--4.6189979070246256487308755822596140205860137939453125e-01,
--4.6325978355186014923106085916515439748764038085937500e-01,
--4.6461868630623792686407114160829223692417144775390625e-01,
--4.6597649576796601467165714893781114369630813598632812e-01,
--4.6733320874198841510249735620163846760988235473632812e-01,
--4.6868882203582767909111339577066246420145034790039062e-01,
--4.7004333245959550868775522758369334042072296142578125e-01,
--4.7139673682599769755086072109406813979148864746093750e-01,
--4.7274903195034256864204280645935796201229095458984375e-01,
--4.7410021465054991152143770705151837319135665893554688e-01,
--4.7545028174715597835131575266132131218910217285156250e-01,
--4.7679923006332197710221976194588933140039443969726562e-01,
--4.7814705642484300884831327493884600698947906494140625e-01,
--4.7949375766015311928214259751257486641407012939453125e-01,
--4.8083933060033379192077518382575362920761108398437500e-01,
--4.8218377207912271886769417506002355366945266723632812e-01,
--4.8352707893291846374950182507745921611785888671875000e-01,
--4.8486924800079100883465343940770253539085388183593750e-01,
--4.8621027612448647348131203216325957328081130981445312e-01,
--4.8755016014843571836578917100268881767988204956054688e-01,
--4.8888889691976311624443951586727052927017211914062500e-01,
--4.9022648328829121489036424463847652077674865722656250e-01,
--4.9156291610654978541106174816377460956573486328125000e-01,
--4.9289819222978398238765862515720073133707046508789062e-01,
--4.9423230851595983947888157672423403710126876831054688e-01,
--4.9556526182577237404913717000454198569059371948242188e-01,
--4.9689704902265452446386007068213075399398803710937500e-01,
--4.9822766697278159098161154361150693148374557495117188e-01,
--4.9955711254508178287281339180481154471635818481445312e-01,
--5.0088538261124082584530015083146281540393829345703125e-01,
--5.0221247404571056627275993378134444355964660644531250e-01,
--5.0353838372571746440087281371233984827995300292968750e-01,
--5.0486310853126759035092163685476407408714294433593750e-01,
--5.0618664534515511732593040505889803171157836914062500e-01,
--5.0750899105297075930565142698469571769237518310546875e-01,
--5.0883014254310710011708351885317824780941009521484375e-01,
--5.1015009670676658704024930557352490723133087158203125e-01,
--5.1146885043797041259239222199539653956890106201171875e-01,
--5.1278640063356273337547008850378915667533874511718750e-01,
--5.1410274419322155026179643755313009023666381835937500e-01,
--5.1541787801946303826383655177778564393520355224609375e-01,
--5.1673179901764965116228722763480618596076965332031250e-01,
--5.1804450409599933635718116420321166515350341796875000e-01,
--5.1935599016558964269307807626319117844104766845703125e-01,
--5.2066625414036693531016908309538848698139190673828125e-01,
--5.2197529293715427822775154709233902394771575927734375e-01,
--5.2328310347565654137014234947855584323406219482421875e-01,
--5.2458968267846872723936257898458279669284820556640625e-01,
--5.2589502747108463065472960806800983846187591552734375e-01,
--5.2719913478190105760035066850832663476467132568359375e-01,
--5.2850200154222837234385679039405658841133117675781250e-01,
--5.2980362468629471628389637771761044859886169433593750e-01,
--5.3110400115125477871202974711195565760135650634765625e-01,
--5.3240312787719790144080889149336144328117370605468750e-01,
--5.3370100180715296378508583075017668306827545166015625e-01,
--5.3499761988709704230160468796384520828723907470703125e-01,
--5.3629297906596307132787160298903472721576690673828125e-01,
--5.3758707629564561614188278326764702796936035156250000e-01,
--5.3887990853100831145638949237763881683349609375000000e-01,
--5.4017147272989285422539751380099914968013763427734375e-01,
--5.4146176585312322249166072651860304176807403564453125e-01,
--5.4275078486451577841620519393472932279109954833984375e-01,
--5.4403852673088393121503258953453041613101959228515625e-01,
--5.4532498842204624178719996052677743136882781982421875e-01,
--5.4661016691083486040980687903356738388538360595703125e-01,
--5.4789405917310018967469886774779297411441802978515625e-01,
--5.4917666218771954422805947615415789186954498291015625e-01,
--5.5045797293660470028697773159365169703960418701171875e-01,
--5.5173798840470744675457126504625193774700164794921875e-01,
--5.5301670558002735678115868722670711576938629150390625e-01,
--5.5429412145362011443694427725858986377716064453125000e-01,
--5.5557023301960195560411648330045863986015319824218750e-01,
--5.5684503727515999305097693650168366730213165283203125e-01,
--5.5811853122055610221252663905033841729164123535156250e-01,
--5.5939071185913580297466296542552299797534942626953125e-01,
--5.6066157619733592021304957597749307751655578613281250e-01,
--5.6193112124468946877442476761643774807453155517578125e-01,
--5.6319934401383398014928616248653270304203033447265625e-01,
--5.6446624152051938505536554657737724483013153076171875e-01,
--5.6573181078361323148584460795973427593708038330078125e-01,
--5.6699604882510845627052731288131326436996459960937500e-01,
--5.6825895267013148970391966940951533615589141845703125e-01,
--5.6952051934694725154884054063586518168449401855468750e-01,
--5.7078074588696714464219894580310210585594177246093750e-01,
--5.7203962932475704850077136143227107822895050048828125e-01,
--5.7329716669804198225790514698019251227378845214843750e-01,
--5.7455335504771576360383278370136395096778869628906250e-01,
--5.7580819141784533865546791275846771895885467529296875e-01,
--5.7706167285567933067369494892773218452930450439453125e-01,
--5.7831379641165547855763406914775259792804718017578125e-01,
--5.7956455913940585489285695075523108243942260742187500e-01,
--5.8081395809576441546795422254945151507854461669921875e-01,
--5.8206199034077554799182507849764078855514526367187500e-01,
--5.8330865293769840196347331584547646343708038330078125e-01,
--5.8455394295301521534469202379113994538784027099609375e-01,
--5.8579785745643886407663103454979136586189270019531250e-01,
--5.8704039352091774706110527404234744608402252197265625e-01,
--5.8828154822264522305630407572607509791851043701171875e-01,
--5.8952131864106394054658721870509907603263854980468750e-01,
--5.9075970185887405339286715388880111277103424072265625e-01,
--5.9199669496204088137147891757194884121417999267578125e-01,
--5.9323229503979990617779094463912770152091979980468750e-01,
--5.9446649918466432094277251962921582162380218505859375e-01,
--5.9569930449243335690567846540943719446659088134765625e-01,
--5.9693070806219661328384518128586933016777038574218750e-01,
--5.9816070699634216190077040664618834853172302246093750e-01,
--5.9938929840056454079189052208676002919673919677734375e-01,
--6.0061647938386875100746919997618533670902252197265625e-01,
--6.0184224705858002657521410583285614848136901855468750e-01,
--6.0306659854034827539237539895111694931983947753906250e-01,
--6.0428953094815585078691810849704779684543609619140625e-01,
--6.0551104140432543410099697211990132927894592285156250e-01,
--6.0673112703452458660535739909391850233078002929687500e-01,
--6.0794978496777352106050784641411155462265014648437500e-01,
--6.0916701233645320634479958243900910019874572753906250e-01,
--6.1038280627630958630192026248550973832607269287109375e-01,
--6.1159716392646179539127615498728118836879730224609375e-01,
--6.1281008242940970820455959255923517048358917236328125e-01,
--6.1402155893103815831324254759238101541996002197265625e-01,
--6.1523159058062670823119333363138139247894287109375000e-01,
--6.1644017453085364621756525593809783458709716796875000e-01,
--6.1764730793780375783796898758737370371818542480468750e-01,
--6.1885298796097620854794740807847119867801666259765625e-01,
--6.2005721176328920662967902899254113435745239257812500e-01,
--6.2125997651108744168624298254144378006458282470703125e-01,
--6.2246127937414996722509386017918586730957031250000000e-01,
--6.2366111752569464155016021322808228433132171630859375e-01,
--6.2485948814238623238992431652150116860866546630859375e-01,
--6.2605638840434352232477976940572261810302734375000000e-01,
--6.2725181549514386070143245888175442814826965332031250e-01,
--6.2844576660183260052860987343592569231986999511718750e-01,
--6.2963823891492709527994975360343232750892639160156250e-01,
--6.3082922962842435943287000554846599698066711425781250e-01,
--6.3201873593980895105204353967565111815929412841796875e-01,
--6.3320675505005730165919430874055251479148864746093750e-01,
--6.3439328416364537677196722142980434000492095947265625e-01,
--6.3557832048855611439819313090993091464042663574218750e-01,
--6.3676186123628431001719718551612459123134613037109375e-01,
--6.3794390362184394405176135478541254997253417968750000e-01,
--6.3912444486377573138469188052113167941570281982421875e-01,
--6.4030348218415145122861531490343622863292694091796875e-01,
--6.4148101280858305095478044677292928099632263183593750e-01,
--6.4265703396622686494055187722551636397838592529296875e-01,
--6.4383154288979127510827993319253437221050262451171875e-01,
--6.4500453681554392737496073095826432108879089355468750e-01,
--6.4617601298331639458893960181740112602710723876953125e-01,
--6.4734596863651194809108346817083656787872314453125000e-01,
--6.4851440102211244109753351949620991945266723632812500e-01,
--6.4968130739068330470331602555233985185623168945312500e-01,
--6.5084668499638076433200239989673718810081481933593750e-01,
--6.5201053109695950027457911346573382616043090820312500e-01,
--6.5317284295377653347003388262237422168254852294921875e-01,
--6.5433361783180044035646005795570090413093566894531250e-01,
--6.5549285299961546069624773735995404422283172607421875e-01,
--6.5665054572942882504804629206773824989795684814453125e-01,
--6.5780669329707863735023920526145957410335540771484375e-01,
--6.5896129298203742763462287257425487041473388671875000e-01,
--6.6011434206742036767678882824839092791080474853515625e-01,
--6.6126583783999215437887642110581509768962860107421875e-01,
--6.6241577759017189475088116523693315684795379638671875e-01,
--6.6356415861203965622650002842419780790805816650390625e-01,
--6.6471097820334490435811858333181589841842651367187500e-01,
--6.6585623366550950041897749542840756475925445556640625e-01,
--6.6699992230363747136578922436456196010112762451171875e-01,
--6.6814204142651856255241682447376661002635955810546875e-01,
--6.6928258834663589826874385835253633558750152587890625e-01,
--6.7042156038017308716803199786227196455001831054687500e-01,
--6.7155895484701844111441459972411394119262695312500000e-01,
--6.7269476907077274674406908161472529172897338867187500e-01,
--6.7382900037875603782566713562118820846080780029296875e-01,
--6.7496164610201203615247322886716574430465698242187500e-01,
--6.7609270357531581208121451709303073585033416748046875e-01,
--6.7722217013718044587022859559510834515094757080078125e-01,
--6.7835004312986124652695707482052966952323913574218750e-01,
--6.7947631989936496665904996916651725769042968750000000e-01,
--6.8060099779545313314343957245000638067722320556640625e-01,
--6.8172407417164959664290790897211991250514984130859375e-01,
--6.8284554638524797010035172206698916852474212646484375e-01,
--6.8396541179731551451936866214964538812637329101562500e-01,
--6.8508366777270024439161488771787844598293304443359375e-01,
--6.8620031168003858823567497893236577510833740234375000e-01,
--6.8731534089175916335534566314890980720520019531250000e-01,
--6.8842875278409032535620326598291285336017608642578125e-01,
--6.8954054473706694050605392476427368819713592529296875e-01,
--6.9065071413453438253782223910093307495117187500000000e-01,
--6.9175925836415763647835319716250523924827575683593750e-01,
--6.9286617481742474033978851366555318236351013183593750e-01,
--6.9397146088965377952462176835979335010051727294921875e-01,
--6.9507511398000076940917324463953264057636260986328125e-01,
--6.9617713149146298601266380501328967511653900146484375e-01,
--6.9727751083088640449147987965261563658714294433593750e-01,
--6.9837624940897280456653106739395298063755035400390625e-01,
--6.9947334464028387834844124881783500313758850097656250e-01,
--7.0056879394324822474260372473509050905704498291015625e-01,
--7.0166259474016856589884127970435656607151031494140625e-01,
--7.0275474445722507788048005750169977545738220214843750e-01,
--7.0384524052448482756005887495120987296104431152343750e-01,
--7.0493408037590488124379817236331291496753692626953125e-01,
--7.0602126144933963214356253956793807446956634521484375e-01,
--7.0710678118654746171500846685376018285751342773437500e-01,
--7.0819063703319540259428777062566950917243957519531250e-01,
--7.0927282643886546686928795679705217480659484863281250e-01,
--7.1035334685706230661850213436991907656192779541015625e-01,
--7.1143219574521654458010289090452715754508972167968750e-01,
--7.1250937056469221264620728106820024549961090087890625e-01,
--7.1358486878079363524562950260587967932224273681640625e-01,
--7.1465868786276887103525723432539962232112884521484375e-01,
--7.1573082528381859468424863734981045126914978027343750e-01,
--7.1680127852109953856540869310265406966209411621093750e-01,
--7.1787004505573159818254680430982261896133422851562500e-01,
--7.1893712237280438248632208342314697802066802978515625e-01,
--7.2000250796138165476634185324655845761299133300781250e-01,
--7.2106619931450799398930939787533134222030639648437500e-01,
--7.2212819392921523409256678860401734709739685058593750e-01,
--7.2318848930652745998770569713087752461433410644531250e-01,
--7.2424708295146678072029544637189246714115142822265625e-01,
--7.2530397237306076796414799900958314538002014160156250e-01,
--7.2635915508434578669039183296263217926025390625000000e-01,
--7.2741262860237565490706401760689914226531982421875000e-01,
--7.2846439044822519637278901427634991705417633056640625e-01,
--7.2951443814699679091262396468664519488811492919921875e-01,
--7.3056276922782747984541629193699918687343597412109375e-01,
--7.3160938122389262971978496352676302194595336914062500e-01,
--7.3265427167241270467457070481032133102416992187500000e-01,
--7.3369743811466026084389113748329691588878631591796875e-01,
--7.3473887809596349907081958008348010480403900146484375e-01,
--7.3577858916571337033474264899268746376037597656250000e-01,
--7.3681656887736990402260062182904221117496490478515625e-01,
--7.3785281478846576064256623794790357351303100585937500e-01,
--7.3888732446061500258593923717853613197803497314453125e-01,
--7.3992009545951620275161531026242300868034362792968750e-01,
--7.4095112535495888383962892476120032370090484619140625e-01,
--7.4198041172083095684541831360547803342342376708984375e-01,
--7.4300795213512171866199196301749907433986663818359375e-01,
--7.4403374417992917955189113854430615901947021484375000e-01,
--7.4505778544146594732922039838740602135658264160156250e-01,
--7.4608007351006389029635101906023919582366943359375000e-01,
--7.4710060598018002142595150871784426271915435791015625e-01,
--7.4811938045040360378834520815871655941009521484375000e-01,
--7.4913639452345914815367677874746732413768768310546875e-01,
--7.5015164580621496170920181612018495798110961914062500e-01,
--7.5116513190968647872836072565405629575252532958984375e-01,
--7.5217685044904247781971662334399297833442687988281250e-01,
--7.5318679904361240939891786183579824864864349365234375e-01,
--7.5419497531688917124625959331751801073551177978515625e-01,
--7.5520137689653643597864629555260762572288513183593750e-01,
--7.5620600141439442420931982269394211471080780029296875e-01,
--7.5720884650648456748456283094128593802452087402343750e-01,
--7.5820990981301517042112436683964915573596954345703125e-01,
--7.5920918897838796102206515570287592709064483642578125e-01,
--7.6020668165120219850194871469284407794475555419921875e-01,
--7.6120238548426177871419895382132381200790405273437500e-01,
--7.6219629813457889788708143896656110882759094238281250e-01,
--7.6318841726338104702875853035948239266872406005859375e-01,
--7.6417874053611667406471497088205069303512573242187500e-01,
--7.6516726562245895859604161159950308501720428466796875e-01,
--7.6615399019631280630449055024655535817146301269531250e-01,
--7.6713891193582028904529579449445009231567382812500000e-01,
--7.6812202852336541880617915012408047914505004882812500e-01,
--7.6910333764557947677786842177738435566425323486328125e-01,
--7.7008283699334789673685008892789483070373535156250000e-01,
--7.7106052426181359571444318135036155581474304199218750e-01,
--7.7203639715038441249106426766957156360149383544921875e-01,
--7.7301045336273699337681364340824075043201446533203125e-01,
--7.7398269060682267639350584431667812168598175048828125e-01,
--7.7495310659487381954591000976506620645523071289062500e-01,
--7.7592169904340768660233607079135254025459289550781250e-01,
--7.7688846567323233127666526343091391026973724365234375e-01,
--7.7785340420945303652189295462449081242084503173828125e-01,
--7.7881651238147597826610990523477084934711456298828125e-01,
--7.7977778792301433163913770840736106038093566894531250e-01,
--7.8073722857209448822146669044741429388523101806640625e-01,
--7.8169483207105916466872486125794239342212677001953125e-01,
--7.8265059616657561836206014049821533262729644775390625e-01,
--7.8360451860963820092109699544380418956279754638671875e-01,
--7.8455659715557513056438665444147773087024688720703125e-01,
--7.8550682956405393220222777017625048756599426269531250e-01,
--7.8645521359908576730646245778189040720462799072265625e-01,
--7.8740174702903120707020434565492905676364898681640625e-01,
--7.8834642762660622761217155129997991025447845458984375e-01,
--7.8928925316888576269036548183066770434379577636718750e-01,
--7.9023022143730992095100873484625481069087982177734375e-01,
--7.9116933021769020317748299930826760828495025634765625e-01,
--7.9210657730021216682558815591619350016117095947265625e-01,
--7.9304196047944353065162204075022600591182708740234375e-01,
--7.9397547755433717231454693319392390549182891845703125e-01,
--7.9490712632823679051341514423256739974021911621093750e-01,
--7.9583690460888345530321430487674660980701446533203125e-01,
--7.9676481020841882774163877911632880568504333496093750e-01,
--7.9769084094339093304881771473446860909461975097656250e-01,
--7.9861499463476082194546279424685053527355194091796875e-01,
--7.9953726910790512416582487276173196732997894287109375e-01,
--8.0045766219262270979584172891918569803237915039062500e-01,
--8.0137617172314024038826119067380204796791076660156250e-01,
--8.0229279553811549963171501076431013643741607666015625e-01,
--8.0320753148064483184498385526239871978759765625000000e-01,
--8.0412037739826580651225640394841320812702178955078125e-01,
--8.0503133114296343553206725118798203766345977783203125e-01,
--8.0594039057117627944393234429298900067806243896484375e-01,
--8.0684755354379933400821300892857834696769714355468750e-01,
--8.0775281792619024745505384998978115618228912353515625e-01,
--8.0865618158817498262180833989987149834632873535156250e-01,
--8.0955764240405136966671761911129578948020935058593750e-01,
--8.1045719825259465718403362188837490975856781005859375e-01,
--8.1135484701706372945295697718393057584762573242187500e-01,
--8.1225058658520377097289610901498235762119293212890625e-01,
--8.1314441484925348291312729998026043176651000976562500e-01,
--8.1403632970594841378186856672982685267925262451171875e-01,
--8.1492632905652639951910032323212362825870513916015625e-01,
--8.1581441080673366972320081913494504988193511962890625e-01,
--8.1670057286682784525311262768809683620929718017578125e-01,
--8.1758481315158360036576823404175229370594024658203125e-01,
--8.1846712958029865792042301109177060425281524658203125e-01,
--8.1934752007679700902542663243366405367851257324218750e-01,
--8.2022598256943457517564866066095419228076934814453125e-01,
--8.2110251499110464834529921063221991062164306640625000e-01,
--8.2197711527924133267930528745637275278568267822265625e-01,
--8.2284978137582620583145853743189945816993713378906250e-01,
--8.2372051122739142758888419848517514765262603759765625e-01,
--8.2458930278502506894255930092185735702514648437500000e-01,
--8.2545615400437744035855303081916645169258117675781250e-01,
--8.2632106284566353426868090537027455866336822509765625e-01,
--8.2718402727366902027483774872962385416030883789062500e-01,
--8.2804504525775568524181835527997463941574096679687500e-01,
--8.2890411477186498601099629013333469629287719726562500e-01,
--8.2976123379452293438163223981973715126514434814453125e-01,
--8.3061640030884631435981191316386684775352478027343750e-01,
--8.3146961230254534669370514166075736284255981445312500e-01,
--8.3232086776792957305559639280545525252819061279296875e-01,
--8.3317016470191318511240297084441408514976501464843750e-01,
--8.3401750110601791110553904218249954283237457275390625e-01,
--8.3486287498638001025597077386919409036636352539062500e-01,
--8.3570628435375260423256804642733186483383178710937500e-01,
--8.3654772722351189440104235472972504794597625732421875e-01,
--8.3738720161566182476065023365663364529609680175781250e-01,
--8.3822470555483807874708190865931101143360137939453125e-01,
--8.3906023707031263114686225890181958675384521484375000e-01,
--8.3989379419599952125707886807504110038280487060546875e-01,
--8.4072537497045807253215343735064379870891571044921875e-01,
--8.4155497743689833267666244864813052117824554443359375e-01,
--8.4238259964318584760434305280796252191066741943359375e-01,
--8.4320823964184532517407433260814286768436431884765625e-01,
--8.4403189549006640834960535357822664082050323486328125e-01,
--8.4485356524970711689093150198459625244140625000000000e-01,
--8.4567324698729895438020776055054739117622375488281250e-01,
--8.4649093877405201524766198417637497186660766601562500e-01,
--8.4730663868585842646297123792464844882488250732421875e-01,
--8.4812034480329712149426768519333563745021820068359375e-01,
--8.4893205521163961346786663852981291711330413818359375e-01,
--8.4974176800085254868122319749090820550918579101562500e-01,
--8.5054948126560336874035783694125711917877197265625000e-01,
--8.5135519310526508451886229522642679512500762939453125e-01,
--8.5215890162391971784927591215819120407104492187500000e-01,
--8.5296060493036363059360382976592518389225006103515625e-01,
--8.5376030113811141042390318034449592232704162597656250e-01,
--8.5455798836540042273668404959607869386672973632812500e-01,
--8.5535366473519602870112521486589685082435607910156250e-01,
--8.5614732837519458286124063306488096714019775390625000e-01,
--8.5693897741782865118409517890540882945060729980468750e-01,
--8.5772861000027200706341545810573734343051910400390625e-01,
--8.5851622426444285096636122034396976232528686523437500e-01,
--8.5930181835700836234792632239987142384052276611328125e-01,
--8.6008539042939013974375939142191782593727111816406250e-01,
--8.6086693863776708735002785033429972827434539794921875e-01,
--8.6164646114308129920544843116658739745616912841796875e-01,
--8.6242395611104050168194135039811953902244567871093750e-01,
--8.6319942171212404868896328480332158505916595458984375e-01,
--8.6397285612158669643179109698394313454627990722656250e-01,
--8.6474425751946237816980556090129539370536804199218750e-01,
--8.6551362409056897817549725004937499761581420898437500e-01,
--8.6628095402451299467116996311233378946781158447265625e-01,
--8.6704624551569264845340967440279200673103332519531250e-01,
--8.6780949676330321196360273461323231458663940429687500e-01,
--8.6857070597134089506852205886389128863811492919921875e-01,
--8.6932987134860661981861085223499685525894165039062500e-01,
--8.7008699110871134951850081051816232502460479736328125e-01,
--8.7084206347007897530687614562339149415493011474609375e-01,
--8.7159508665595086807087454872089438140392303466796875e-01,
--8.7234605889439142956121031602378934621810913085937500e-01,
--8.7309497841829009079361867406987585127353668212890625e-01,
--8.7384184346536675214167644298868253827095031738281250e-01,
--8.7458665227817611320659807461197488009929656982421875e-01,
--8.7532940310411089246400706542772240936756134033203125e-01,
--8.7607009419540649020063938223756849765777587890625000e-01,
--8.7680872380914565145104688781430013477802276611328125e-01,
--8.7754529020726113053285644127754494547843933105468750e-01,
--8.7827979165654146420649794890778139233589172363281250e-01,
--8.7901222642863352518816100200638175010681152343750000e-01,
--8.7974259280004729610880076506873592734336853027343750e-01,
--8.8047088905216075449544632647302933037281036376953125e-01,
--8.8119711347122209321724994879332371056079864501953125e-01,
--8.8192126434835493853370280703529715538024902343750000e-01,
--8.8264333997956279098673348926240578293800354003906250e-01,
--8.8336333866573168993596709697158075869083404541015625e-01,
--8.8408125871263487649542867075069807469844818115234375e-01,
--8.8479709843093778953715400348301045596599578857421875e-01,
--8.8551085613619984204802904059761203825473785400390625e-01,
--8.8622253014888052735642531843041069805622100830078125e-01,
--8.8693211879434219468976152711547911167144775390625000e-01,
--8.8763962040285382393278723611729219555854797363281250e-01,
--8.8834503330959624367579863246646709740161895751953125e-01,
--8.8904835585466457370529269610415212810039520263671875e-01,
--8.8974958638307277691836816302384249866008758544921875e-01,
--8.9044872324475787817021910086623392999172210693359375e-01,
--8.9114576479458329494320878438884392380714416503906250e-01,
--8.9184070939234261210515342099824920296669006347656250e-01,
--8.9253355540276457791293296395451761782169342041015625e-01,
--8.9322430119551521343623790016863495111465454101562500e-01,
--8.9391294514520325265038991346955299377441406250000000e-01,
--8.9459948563138269594929852246423251926898956298828125e-01,
--8.9528392103855736205986204367945902049541473388671875e-01,
--8.9596624975618510688946116715669631958007812500000000e-01,
--8.9664647017868026601661313179647549986839294433593750e-01,
--8.9732458070541820660537268850021064281463623046875000e-01,
--8.9800057974073976829743060079636052250862121582031250e-01,
--8.9867446569395392774737274521612562239170074462890625e-01,
--8.9934623697934146235866137431003153324127197265625000e-01,
--9.0001589201616027935415331739932298660278320312500000e-01,
--9.0068342922864674804372953076381236314773559570312500e-01,
--9.0134884704602191707323299851850606501102447509765625e-01,
--9.0201214390249317975900567034841515123844146728515625e-01,
--9.0267331823725871497998696213471703231334686279296875e-01,
--9.0333236849451181704750979406526312232017517089843750e-01,
--9.0398929312344333819595476597896777093410491943359375e-01,
--9.0464409057824612947484865799196995794773101806640625e-01,
--9.0529675931811870448484569351421669125556945800781250e-01,
--9.0594729780726845902449895220343023538589477539062500e-01,
--9.0659570451491533482624163298169150948524475097656250e-01,
--9.0724197791529581635927570459898561239242553710937500e-01,
--9.0788611648766615047634331858716905117034912109375000e-01,
--9.0852811871630612117201053479220718145370483398437500e-01,
--9.0916798309052238025174119684379547834396362304687500e-01,
--9.0980570810465211106787819517194293439388275146484375e-01,
--9.1044129225806713634483458008617162704467773437500000e-01,
--9.1107473405517636066974773711990565061569213867187500e-01,
--9.1170603200542976729536803759401664137840270996093750e-01,
--9.1233518462332274800985487672733142971992492675781250e-01,
--9.1296219042839821256052346143405884504318237304687500e-01,
--9.1358704794525080750133838591864332556724548339843750e-01,
--9.1420975570353069095119735720800235867500305175781250e-01,
--9.1483031223794597508458537049591541290283203125000000e-01,
--9.1544871608826772213518552234745584428310394287109375e-01,
--9.1606496579933172075271841094945557415485382080078125e-01,
--9.1667905992104259382813324918970465660095214843750000e-01,
--9.1729099700837790631879897773615084588527679443359375e-01,
--9.1790077562139049671685597786563448607921600341796875e-01,
--9.1850839432521214078519733448047190904617309570312500e-01,
--9.1911385169005777040496241170330904424190521240234375e-01,
--9.1971714629122736095467871564324013888835906982421875e-01,
--9.2031827670911048322466285753762349486351013183593750e-01,
--9.2091724152918941204148950419039465487003326416015625e-01,
--9.2151403934204179080325047834776341915130615234375000e-01,
--9.2210866874334507237165325932437554001808166503906250e-01,
--9.2270112833387862849576777080073952674865722656250000e-01,
--9.2329141671952752457031010635546408593654632568359375e-01,
--9.2387953251128673848313610506011173129081726074218750e-01,
--9.2446547432526260390517336418270133435726165771484375e-01,
--9.2504924078267747322712466484517790377140045166015625e-01,
--9.2563083050987271516163445994607172906398773193359375e-01,
--9.2621024213831137927854797453619539737701416015625000e-01,
--9.2678747430458174871859000631957314908504486083984375e-01,
--9.2736252565040111495164865118567831814289093017578125e-01,
--9.2793539482261777617821962849120609462261199951171875e-01,
--9.2850608047321547822150478168623521924018859863281250e-01,
--9.2907458125931585701806625365861691534519195556640625e-01,
--9.2964089584318121417538804962532594799995422363281250e-01,
--9.3020502289221906888627700027427636086940765380859375e-01,
--9.3076696107898371224109723698347806930541992187500000e-01,
--9.3132670908118042607526376741589047014713287353515625e-01,
--9.3188426558166814750450157589511945843696594238281250e-01,
--9.3243962926846246652701211132807657122611999511718750e-01,
--9.3299279883473884567024470015894621610641479492187500e-01,
--9.3354377297883617270457534687011502683162689208984375e-01,
--9.3409255040425875904475105926394462585449218750000000e-01,
--9.3463912981968066961968588657327927649021148681640625e-01,
--9.3518350993894761025160278222756460309028625488281250e-01,
--9.3572568948108025832510747932246886193752288818359375e-01,
--9.3626566717027825959007714118342846632003784179687500e-01,
--9.3680344173592167145159237406915053725242614746093750e-01,
--9.3733901191257484875052341521950438618659973144531250e-01,
--9.3787237643998977443260400832514278590679168701171875e-01,
--9.3840353406310816897217819132492877542972564697265625e-01,
--9.3893248353206448797436678432859480381011962890625000e-01,
--9.3945922360218991897795604018028825521469116210937500e-01,
--9.3998375303401393576763211967772804200649261474609375e-01,
--9.4050607059326829517686974213575012981891632080078125e-01,
--9.4102617505088925753398143569938838481903076171875000e-01,
--9.4154406518302069528658648778218775987625122070312500e-01,
--9.4205973977101731264838235802017152309417724609375000e-01,
--9.4257319760144686604519392858492210507392883300781250e-01,
--9.4308443746609338376174491713754832744598388671875000e-01,
--9.4359345816196038558842928978265263140201568603515625e-01,
--9.4410025849127265917815066131879575550556182861328125e-01,
--9.4460483726148025684921094580204226076602935791015625e-01,
--9.4510719328526060500905714434338733553886413574218750e-01,
--9.4560732538052127971184290800010785460472106933593750e-01,
--9.4610523237040333732750241324538365006446838378906250e-01,
--9.4660091308328353498779961228137835860252380371093750e-01,
--9.4709436635277710614388979593059048056602478027343750e-01,
--9.4758559101774109123539346910547465085983276367187500e-01,
--9.4807458592227622506953821357456035912036895751953125e-01,
--9.4856134991573026749023256343207322061061859130859375e-01,
--9.4904588185270055689102264295797795057296752929687500e-01,
--9.4952818059303667475035126699367538094520568847656250e-01,
--9.5000824500184299914451457880204543471336364746093750e-01,
--9.5048607394948170234982853799010626971721649169921875e-01,
--9.5096166631157497128867817082209512591361999511718750e-01,
--9.5143502096900833819859144568908959627151489257812500e-01,
--9.5190613680793234596677621084381826221942901611328125e-01,
--9.5237501271976576777689160735462792217731475830078125e-01,
--9.5284164760119860471121455702814273536205291748046875e-01,
--9.5330604035419386210747916265972889959812164306640625e-01,
--9.5376818988599021409413580840919166803359985351562500e-01,
--9.5422809510910555630402996030170470476150512695312500e-01,
--9.5468575494133844916433417893131263554096221923828125e-01,
--9.5514116830577067140950475732097402215003967285156250e-01,
--9.5559433413077110586186790897045284509658813476562500e-01,
--9.5604525134999629454313208043458871543407440185546875e-01,
--9.5649391890239499058878891446511261165142059326171875e-01,
--9.5694033573220882438192802510457113385200500488281250e-01,
--9.5738450078897585626691579818725585937500000000000000e-01,
--9.5782641302753290801774710416793823242187500000000000e-01,
--9.5826607140801767226179208591929636895656585693359375e-01,
--9.5870347489587148803735772162326611578464508056640625e-01,
--9.5913862246184189430664446263108402490615844726562500e-01,
--9.5957151308198451733488809622940607368946075439453125e-01,
--9.6000214573766584624792130853165872395038604736328125e-01,
--9.6043051941556578654513032233808189630508422851562500e-01,
--9.6085663310767954747859675990184769034385681152343750e-01,
--9.6128048581132063965526413085171952843666076660156250e-01,
--9.6170207652912254037147476992686279118061065673828125e-01,
--9.6212140426904158019283386238384991884231567382812500e-01,
--9.6253846804435916340025869430974125862121582031250000e-01,
--9.6295326687368387741372544041951186954975128173828125e-01,
--9.6336579978095393528292333940044045448303222656250000e-01,
--9.6377606579543984022251379428780637681484222412109375e-01,
--9.6418406395174582890206238516839221119880676269531250e-01,
--9.6458979328981264700360043207183480262756347656250000e-01,
--9.6499325285492032477918655786197632551193237304687500e-01,
--9.6539444169768928727393131339340470731258392333984375e-01,
--9.6579335887408357397276859046542085707187652587890625e-01,
--9.6619000344541261515729502207250334322452545166015625e-01,
--9.6658437447833300826260938265477307140827178955078125e-01,
--9.6697647104485207059099138859892264008522033691406250e-01,
--9.6736629222232850544571647333214059472084045410156250e-01,
--9.6775383709347539973322227524477057158946990966796875e-01,
--9.6813910474636233338685542548773810267448425292968750e-01,
--9.6852209427441737776831587325432337820529937744140625e-01,
--9.6890280477642887202449628603062592446804046630859375e-01,
--9.6928123535654853171195100003387778997421264648437500e-01,
--9.6965738512429233697531572033767588436603546142578125e-01,
--9.7003125319454397423868385885725729167461395263671875e-01,
--9.7040283868755550233942130944342352449893951416015625e-01,
--9.7077214072895023910803047328954562544822692871093750e-01,
--9.7113915844972509283650197176029905676841735839843750e-01,
--9.7150389098625178352364173406385816633701324462890625e-01,
--9.7186633748027928536572517259628511965274810791015625e-01,
--9.7222649707893626924715135828591883182525634765625000e-01,
--9.7258436893473221296346764574991539120674133300781250e-01,
--9.7293995220556006575662877366994507610797882080078125e-01,
--9.7329324605469824671644119007396511733531951904296875e-01,
--9.7364424965081186602589014000841416418552398681640625e-01,
--9.7399296216795583358560861597652547061443328857421875e-01,
--9.7433938278557585821459952057921327650547027587890625e-01,
--9.7468351068851066809628491682815365493297576904296875e-01,
--9.7502534506699412020225281594321131706237792968750000e-01,
--9.7536488511665697664909657760290428996086120605468750e-01,
--9.7570213003852845901064938516356050968170166015625000e-01,
--9.7603707903903902387554580855066888034343719482421875e-01,
--9.7636973133002114000333904186845757067203521728515625e-01,
--9.7670008612871184183745754125993698835372924804687500e-01,
--9.7702814265775439483974196264171041548252105712890625e-01,
--9.7735390014519996082498209943878464400768280029296875e-01,
--9.7767735782450992942926859541330486536026000976562500e-01,
--9.7799851493455713935532003233674913644790649414062500e-01,
--9.7831737071962754370701986772473901510238647460937500e-01,
--9.7863392442942309656928046024404466152191162109375000e-01,
--9.7894817531906219709725291977520100772380828857421875e-01,
--9.7926012264908202098467882024124264717102050781250000e-01,
--9.7956976568544051886533452488947659730911254882812500e-01,
--9.7987710369951763755835827396367676556110382080078125e-01,
--9.8018213596811731846969450998585671186447143554687500e-01,
--9.8048486177346938497123574052238836884498596191406250e-01,
--9.8078528040323043057924223830923438072204589843750000e-01,
--9.8108339115048659451190360414329916238784790039062500e-01,
--9.8137919331375456089006092952331528067588806152343750e-01,
--9.8167268619698311304944127186900004744529724121093750e-01,
--9.8196386910955524296440444231848232448101043701171875e-01,
--9.8225274136628937249327009340049698948860168457031250e-01,
--9.8253930228744124075745958180050365626811981201171875e-01,
--9.8282355119870523640912551854853518307209014892578125e-01,
--9.8310548743121628501029363178531639277935028076171875e-01,
--9.8338511032155118130049231695011258125305175781250000e-01,
--9.8366241921173025453128957451554015278816223144531250e-01,
--9.8393741344921892277852748520672321319580078125000000e-01,
--9.8421009238692902520995176018914207816123962402343750e-01,
--9.8448045538322093150895852886606007814407348632812500e-01,
--9.8474850180190420800840911397244781255722045898437500e-01,
--9.8501423101223983813667928188806399703025817871093750e-01,
--9.8527764238894122161838140527834184467792510986328125e-01,
--9.8553873531217606185350632586050778627395629882812500e-01,
--9.8579750916756736511814551704446785151958465576171875e-01,
--9.8605396334619543896593540921458043158054351806640625e-01,
--9.8630809724459866938417462733923457562923431396484375e-01,
--9.8655991026477540817296585373696871101856231689453125e-01,
--9.8680940181418552725745030329562723636627197265625000e-01,
--9.8705657130575097379932003605063073337078094482421875e-01,
--9.8730141815785843473207705756067298352718353271484375e-01,
--9.8754394179435922573873085639206692576408386230468750e-01,
--9.8778414164457217783166242952574975788593292236328125e-01,
--9.8802201714328352633032181984162889420986175537109375e-01,
--9.8825756773074946437418475397862493991851806640625000e-01,
--9.8849079285269658701196249239728786051273345947265625e-01,
--9.8872169196032377858074369214591570198535919189453125e-01,
--9.8895026451030298986211164447013288736343383789062500e-01,
--9.8917650996478101443898367506335489451885223388671875e-01,
--9.8940042779138037687403084419202059507369995117187500e-01,
--9.8962201746320077599960995939909480512142181396484375e-01,
--9.8984127845882052820769558820757083594799041748046875e-01,
--9.9005821026229701153908990818308666348457336425781250e-01,
--9.9027281236316910817407688227831386029720306396484375e-01,
--9.9048508425645709341011979631730355322360992431640625e-01,
--9.9069502544266463406330558427725918591022491455078125e-01,
--9.9090263542778000971367191596073098480701446533203125e-01,
--9.9110791372327688986132443460519425570964813232421875e-01,
--9.9131085984611544414946138203958980739116668701171875e-01,
--9.9151147331874389667660807390348054468631744384765625e-01,
--9.9170975366909952519733906228793784976005554199218750e-01,
--9.9190570043060932725609291082946583628654479980468750e-01,
--9.9209931314219179654401159496046602725982666015625000e-01,
--9.9229059134825725596584788945619948208332061767578125e-01,
--9.9247953459870996706371215623221360146999359130859375e-01,
--9.9266614244894801899476988182868808507919311523437500e-01,
--9.9285041445986510488808107766089960932731628417968750e-01,
--9.9303235019785141002301998014445416629314422607421875e-01,
--9.9321194923479450000769475082051940262317657470703125e-01,
--9.9338921114808065304657702654367312788963317871093750e-01,
--9.9356413552059530402971176954451948404312133789062500e-01,
--9.9373672194072459884495174264884553849697113037109375e-01,
--9.9390697000235606051177228437154553830623626708984375e-01,
--9.9407487930487936633738854652619920670986175537109375e-01,
--9.9424044945318790222898996944422833621501922607421875e-01,
--9.9440368005767909576064766952185891568660736083984375e-01,
--9.9456457073425541537403660186100751161575317382812500e-01,
--9.9472312110432570264606511045712977647781372070312500e-01,
--9.9487933079480561637808477826183661818504333496093750e-01,
--9.9503319943811863179661258982378058135509490966796875e-01,
--9.9518472667219681770944816889823414385318756103515625e-01,
--9.9533391214048227979560579115059226751327514648437500e-01,
--9.9548075549192693856070945912506431341171264648437500e-01,
--9.9562525638099430569383230249513871967792510986328125e-01,
--9.9576741446765981713440396561054512858390808105468750e-01,
--9.9590722941741172125063030762248672544956207275390625e-01,
--9.9604470090125196701791310260887257754802703857421875e-01,
--9.9617982859569687015266481466824188828468322753906250e-01,
--9.9631261218277800129072829804499633610248565673828125e-01,
--9.9644305135004263007658664719201624393463134765625000e-01,
--9.9657114579055483538638782192720100283622741699218750e-01,
--9.9669689520289606043945696001173928380012512207031250e-01,
--9.9682029929116566790980868972837924957275390625000000e-01,
--9.9694135776498216117147421755362302064895629882812500e-01,
--9.9706007033948296225389640312641859054565429687500000e-01,
--9.9717643673532607717646669698297046124935150146484375e-01,
--9.9729045667869020697082760307239368557929992675781250e-01,
--9.9740212990127530279238499133498407900333404541015625e-01,
--9.9751145614030345409872779782745055854320526123046875e-01,
--9.9761843513851955478344279981683939695358276367187500e-01,
--9.9772306664419163624302200332749634981155395507812500e-01,
--9.9782535041111164453297988075064495205879211425781250e-01,
--9.9792528619859599547936568342265672981739044189453125e-01,
--9.9802287377148624081257821671897545456886291503906250e-01,
--9.9811811290014917918966830256977118551731109619140625e-01,
--9.9821100336047818846196832964778877794742584228515625e-01,
--9.9830154493389289260818486582138575613498687744140625e-01,
--9.9838973740734016093512082079541869461536407470703125e-01,
--9.9847558057329477421149022120516747236251831054687500e-01,
--9.9855907422975931364561574810068123042583465576171875e-01,
--9.9864021818026516008615089958766475319862365722656250e-01,
--9.9871901223387293811128984089009463787078857421875000e-01,
--9.9879545620517240500646494183456525206565856933593750e-01,
--9.9886954991428356098737140200682915747165679931640625e-01,
--9.9894129318685687124457217578310519456863403320312500e-01,
--9.9901068585407337696580043484573252499103546142578125e-01,
--9.9907772775264536146977434327709488570690155029296875e-01,
--9.9914241872481690531770937013789080083370208740234375e-01,
--9.9920475861836388631331828946713358163833618164062500e-01,
--9.9926474728659442359202103034476749598979949951171875e-01,
--9.9932238458834954375475945198559202253818511962890625e-01,
--9.9937767038800284780108995619229972362518310546875000e-01,
--9.9943060455546173237451057502767071127891540527343750e-01,
--9.9948118696616694567325112075195647776126861572265625e-01,
--9.9952941750109314256178549840115010738372802734375000e-01,
--9.9957529604674921763773909333394840359687805175781250e-01,
--9.9961882249517863829879615877871401607990264892578125e-01,
--9.9965999674395922269809489080216735601425170898437500e-01,
--9.9969881869620424996725205346592701971530914306640625e-01,
--9.9973528826056168306024574121693149209022521972656250e-01,
--9.9976940535121527897644000404397957026958465576171875e-01,
--9.9980116988788425569367745993076823651790618896484375e-01,
--9.9983058179582340319058175737154670059680938720703125e-01,
--9.9985764100582386060267481298069469630718231201171875e-01,
--9.9988234745421256111086449891445226967334747314453125e-01,
--9.9990470108285278705295695544918999075889587402343750e-01,
--9.9992470183914450299056397852837108075618743896484375e-01,
--9.9994234967602391161989316969993524253368377685546875e-01,
--9.9995764455196389786095778617891483008861541748046875e-01,
--9.9997058643097413987987920336308889091014862060546875e-01,
--9.9998117528260110908888691483298316597938537597656250e-01,
--9.9998941108192840321322591989883221685886383056640625e-01,
--9.9999529380957619117964441102230921387672424316406250e-01,
--9.9999882345170187925020854891045019030570983886718750e-01,
--1.0000000000000000000000000000000000000000000000000000e+00,
--9.9999882345170187925020854891045019030570983886718750e-01,
--9.9999529380957619117964441102230921387672424316406250e-01,
--9.9998941108192840321322591989883221685886383056640625e-01,
--9.9998117528260110908888691483298316597938537597656250e-01,
--9.9997058643097413987987920336308889091014862060546875e-01,
--9.9995764455196389786095778617891483008861541748046875e-01,
--9.9994234967602391161989316969993524253368377685546875e-01,
--9.9992470183914450299056397852837108075618743896484375e-01,
--9.9990470108285289807525941796484403312206268310546875e-01,
--9.9988234745421256111086449891445226967334747314453125e-01,
--9.9985764100582386060267481298069469630718231201171875e-01,
--9.9983058179582340319058175737154670059680938720703125e-01,
--9.9980116988788425569367745993076823651790618896484375e-01,
--9.9976940535121527897644000404397957026958465576171875e-01,
--9.9973528826056168306024574121693149209022521972656250e-01,
--9.9969881869620424996725205346592701971530914306640625e-01,
--9.9965999674395922269809489080216735601425170898437500e-01,
--9.9961882249517863829879615877871401607990264892578125e-01,
--9.9957529604674921763773909333394840359687805175781250e-01,
--9.9952941750109314256178549840115010738372802734375000e-01,
--9.9948118696616694567325112075195647776126861572265625e-01,
--9.9943060455546173237451057502767071127891540527343750e-01,
--9.9937767038800284780108995619229972362518310546875000e-01,
--9.9932238458834954375475945198559202253818511962890625e-01,
--9.9926474728659442359202103034476749598979949951171875e-01,
--9.9920475861836388631331828946713358163833618164062500e-01,
--9.9914241872481690531770937013789080083370208740234375e-01,
--9.9907772775264536146977434327709488570690155029296875e-01,
--9.9901068585407337696580043484573252499103546142578125e-01,
--9.9894129318685687124457217578310519456863403320312500e-01,
--9.9886954991428356098737140200682915747165679931640625e-01,
--9.9879545620517240500646494183456525206565856933593750e-01,
--9.9871901223387293811128984089009463787078857421875000e-01,
--9.9864021818026527110845336210331879556179046630859375e-01,
--9.9855907422975931364561574810068123042583465576171875e-01,
--9.9847558057329477421149022120516747236251831054687500e-01,
--9.9838973740734016093512082079541869461536407470703125e-01,
--9.9830154493389289260818486582138575613498687744140625e-01,
--9.9821100336047818846196832964778877794742584228515625e-01,
--9.9811811290014917918966830256977118551731109619140625e-01,
--9.9802287377148624081257821671897545456886291503906250e-01,
--9.9792528619859599547936568342265672981739044189453125e-01,
--9.9782535041111164453297988075064495205879211425781250e-01,
--9.9772306664419163624302200332749634981155395507812500e-01,
--9.9761843513851955478344279981683939695358276367187500e-01,
--9.9751145614030345409872779782745055854320526123046875e-01,
--9.9740212990127530279238499133498407900333404541015625e-01,
--9.9729045667869020697082760307239368557929992675781250e-01,
--9.9717643673532618819876915949862450361251831054687500e-01,
--9.9706007033948296225389640312641859054565429687500000e-01,
--9.9694135776498216117147421755362302064895629882812500e-01,
--9.9682029929116577893211115224403329193592071533203125e-01,
--9.9669689520289606043945696001173928380012512207031250e-01,
--9.9657114579055483538638782192720100283622741699218750e-01,
--9.9644305135004263007658664719201624393463134765625000e-01,
--9.9631261218277800129072829804499633610248565673828125e-01,
--9.9617982859569698117496727718389593064785003662109375e-01,
--9.9604470090125196701791310260887257754802703857421875e-01,
--9.9590722941741172125063030762248672544956207275390625e-01,
--9.9576741446765981713440396561054512858390808105468750e-01,
--9.9562525638099430569383230249513871967792510986328125e-01,
--9.9548075549192693856070945912506431341171264648437500e-01,
--9.9533391214048227979560579115059226751327514648437500e-01,
--9.9518472667219692873175063141388818621635437011718750e-01,
--9.9503319943811863179661258982378058135509490966796875e-01,
--9.9487933079480561637808477826183661818504333496093750e-01,
--9.9472312110432570264606511045712977647781372070312500e-01,
--9.9456457073425552639633906437666155397891998291015625e-01,
--9.9440368005767909576064766952185891568660736083984375e-01,
--9.9424044945318790222898996944422833621501922607421875e-01,
--9.9407487930487947735969100904185324907302856445312500e-01,
--9.9390697000235606051177228437154553830623626708984375e-01,
--9.9373672194072470986725420516449958086013793945312500e-01,
--9.9356413552059530402971176954451948404312133789062500e-01,
--9.9338921114808065304657702654367312788963317871093750e-01,
--9.9321194923479461102999721333617344498634338378906250e-01,
--9.9303235019785141002301998014445416629314422607421875e-01,
--9.9285041445986510488808107766089960932731628417968750e-01,
--9.9266614244894801899476988182868808507919311523437500e-01,
--9.9247953459870996706371215623221360146999359130859375e-01,
--9.9229059134825736698815035197185352444648742675781250e-01,
--9.9209931314219179654401159496046602725982666015625000e-01,
--9.9190570043060932725609291082946583628654479980468750e-01,
--9.9170975366909952519733906228793784976005554199218750e-01,
--9.9151147331874400769891053641913458704948425292968750e-01,
--9.9131085984611544414946138203958980739116668701171875e-01,
--9.9110791372327688986132443460519425570964813232421875e-01,
--9.9090263542778000971367191596073098480701446533203125e-01,
--9.9069502544266463406330558427725918591022491455078125e-01,
--9.9048508425645709341011979631730355322360992431640625e-01,
--9.9027281236316910817407688227831386029720306396484375e-01,
--9.9005821026229712256139237069874070584774017333984375e-01,
--9.8984127845882052820769558820757083594799041748046875e-01,
--9.8962201746320088702191242191474884748458862304687500e-01,
--9.8940042779138037687403084419202059507369995117187500e-01,
--9.8917650996478101443898367506335489451885223388671875e-01,
--9.8895026451030298986211164447013288736343383789062500e-01,
--9.8872169196032377858074369214591570198535919189453125e-01,
--9.8849079285269669803426495491294190287590026855468750e-01,
--9.8825756773074946437418475397862493991851806640625000e-01,
--9.8802201714328363735262428235728293657302856445312500e-01,
--9.8778414164457217783166242952574975788593292236328125e-01,
--9.8754394179435922573873085639206692576408386230468750e-01,
--9.8730141815785843473207705756067298352718353271484375e-01,
--9.8705657130575108482162249856628477573394775390625000e-01,
--9.8680940181418552725745030329562723636627197265625000e-01,
--9.8655991026477551919526831625262275338172912597656250e-01,
--9.8630809724459866938417462733923457562923431396484375e-01,
--9.8605396334619543896593540921458043158054351806640625e-01,
--9.8579750916756747614044797956012189388275146484375000e-01,
--9.8553873531217606185350632586050778627395629882812500e-01,
--9.8527764238894133264068386779399588704109191894531250e-01,
--9.8501423101223983813667928188806399703025817871093750e-01,
--9.8474850180190420800840911397244781255722045898437500e-01,
--9.8448045538322093150895852886606007814407348632812500e-01,
--9.8421009238692913623225422270479612052440643310546875e-01,
--9.8393741344921892277852748520672321319580078125000000e-01,
--9.8366241921173036555359203703119419515132904052734375e-01,
--9.8338511032155118130049231695011258125305175781250000e-01,
--9.8310548743121639603259609430097043514251708984375000e-01,
--9.8282355119870534743142798106418922543525695800781250e-01,
--9.8253930228744124075745958180050365626811981201171875e-01,
--9.8225274136628948351557255591615103185176849365234375e-01,
--9.8196386910955524296440444231848232448101043701171875e-01,
--9.8167268619698311304944127186900004744529724121093750e-01,
--9.8137919331375467191236339203896932303905487060546875e-01,
--9.8108339115048670553420606665895320475101470947265625e-01,
--9.8078528040323043057924223830923438072204589843750000e-01,
--9.8048486177346938497123574052238836884498596191406250e-01,
--9.8018213596811742949199697250151075422763824462890625e-01,
--9.7987710369951774858066073647933080792427062988281250e-01,
--9.7956976568544051886533452488947659730911254882812500e-01,
--9.7926012264908202098467882024124264717102050781250000e-01,
--9.7894817531906230811955538229085505008697509765625000e-01,
--9.7863392442942320759158292275969870388507843017578125e-01,
--9.7831737071962765472932233024039305746555328369140625e-01,
--9.7799851493455713935532003233674913644790649414062500e-01,
--9.7767735782451004045157105792895890772342681884765625e-01,
--9.7735390014519996082498209943878464400768280029296875e-01,
--9.7702814265775439483974196264171041548252105712890625e-01,
--9.7670008612871184183745754125993698835372924804687500e-01,
--9.7636973133002125102564150438411161303520202636718750e-01,
--9.7603707903903913489784827106632292270660400390625000e-01,
--9.7570213003852857003295184767921455204486846923828125e-01,
--9.7536488511665697664909657760290428996086120605468750e-01,
--9.7502534506699412020225281594321131706237792968750000e-01,
--9.7468351068851066809628491682815365493297576904296875e-01,
--9.7433938278557596923690198309486731886863708496093750e-01,
--9.7399296216795594460791107849217951297760009765625000e-01,
--9.7364424965081186602589014000841416418552398681640625e-01,
--9.7329324605469824671644119007396511733531951904296875e-01,
--9.7293995220556017677893123618559911847114562988281250e-01,
--9.7258436893473232398577010826556943356990814208984375e-01,
--9.7222649707893638026945382080157287418842315673828125e-01,
--9.7186633748027939638802763511193916201591491699218750e-01,
--9.7150389098625189454594419657951220870018005371093750e-01,
--9.7113915844972520385880443427595309913158416748046875e-01,
--9.7077214072895023910803047328954562544822692871093750e-01,
--9.7040283868755550233942130944342352449893951416015625e-01,
--9.7003125319454397423868385885725729167461395263671875e-01,
--9.6965738512429244799761818285332992672920227050781250e-01,
--9.6928123535654853171195100003387778997421264648437500e-01,
--9.6890280477642887202449628603062592446804046630859375e-01,
--9.6852209427441737776831587325432337820529937744140625e-01,
--9.6813910474636244440915788800339214503765106201171875e-01,
--9.6775383709347551075552473776042461395263671875000000e-01,
--9.6736629222232861646801893584779463708400726318359375e-01,
--9.6697647104485218161329385111457668244838714599609375e-01,
--9.6658437447833311928491184517042711377143859863281250e-01,
--9.6619000344541261515729502207250334322452545166015625e-01,
--9.6579335887408368499507105298107489943504333496093750e-01,
--9.6539444169768939829623377590905874967575073242187500e-01,
--9.6499325285492043580148902037763036787509918212890625e-01,
--9.6458979328981275802590289458748884499073028564453125e-01,
--9.6418406395174582890206238516839221119880676269531250e-01,
--9.6377606579543995124481625680346041917800903320312500e-01,
--9.6336579978095404630522580191609449684619903564453125e-01,
--9.6295326687368398843602790293516591191291809082031250e-01,
--9.6253846804435916340025869430974125862121582031250000e-01,
--9.6212140426904158019283386238384991884231567382812500e-01,
--9.6170207652912265139377723244251683354377746582031250e-01,
--9.6128048581132063965526413085171952843666076660156250e-01,
--9.6085663310767954747859675990184769034385681152343750e-01,
--9.6043051941556589756743278485373593866825103759765625e-01,
--9.6000214573766595727022377104731276631355285644531250e-01,
--9.5957151308198462835719055874506011605262756347656250e-01,
--9.5913862246184200532894692514673806726932525634765625e-01,
--9.5870347489587159905966018413892015814781188964843750e-01,
--9.5826607140801778328409454843495041131973266601562500e-01,
--9.5782641302753290801774710416793823242187500000000000e-01,
--9.5738450078897585626691579818725585937500000000000000e-01,
--9.5694033573220893540423048762022517621517181396484375e-01,
--9.5649391890239510161109137698076665401458740234375000e-01,
--9.5604525134999640556543454295024275779724121093750000e-01,
--9.5559433413077110586186790897045284509658813476562500e-01,
--9.5514116830577078243180721983662806451320648193359375e-01,
--9.5468575494133844916433417893131263554096221923828125e-01,
--9.5422809510910566732633242281735874712467193603515625e-01,
--9.5376818988599032511643827092484571039676666259765625e-01,
--9.5330604035419397312978162517538294196128845214843750e-01,
--9.5284164760119871573351701954379677772521972656250000e-01,
--9.5237501271976587879919406987028196454048156738281250e-01,
--9.5190613680793234596677621084381826221942901611328125e-01,
--9.5143502096900844922089390820474363863468170166015625e-01,
--9.5096166631157508231098063333774916827678680419921875e-01,
--9.5048607394948181337213100050576031208038330078125000e-01,
--9.5000824500184299914451457880204543471336364746093750e-01,
--9.4952818059303678577265372950932942330837249755859375e-01,
--9.4904588185270066791332510547363199293613433837890625e-01,
--9.4856134991573026749023256343207322061061859130859375e-01,
--9.4807458592227633609184067609021440148353576660156250e-01,
--9.4758559101774120225769593162112869322299957275390625e-01,
--9.4709436635277721716619225844624452292919158935546875e-01,
--9.4660091308328364601010207479703240096569061279296875e-01,
--9.4610523237040344834980487576103769242763519287109375e-01,
--9.4560732538052127971184290800010785460472106933593750e-01,
--9.4510719328526060500905714434338733553886413574218750e-01,
--9.4460483726148025684921094580204226076602935791015625e-01,
--9.4410025849127277020045312383444979786872863769531250e-01,
--9.4359345816196038558842928978265263140201568603515625e-01,
--9.4308443746609349478404737965320236980915069580078125e-01,
--9.4257319760144697706749639110057614743709564208984375e-01,
--9.4205973977101742367068482053582556545734405517578125e-01,
--9.4154406518302080630888895029784180223941802978515625e-01,
--9.4102617505088936855628389821504242718219757080078125e-01,
--9.4050607059326840619917220465140417218208312988281250e-01,
--9.3998375303401393576763211967772804200649261474609375e-01,
--9.3945922360219003000025850269594229757785797119140625e-01,
--9.3893248353206459899666924684424884617328643798828125e-01,
--9.3840353406310827999448065384058281779289245605468750e-01,
--9.3787237643998988545490647084079682826995849609375000e-01,
--9.3733901191257495977282587773515842854976654052734375e-01,
--9.3680344173592167145159237406915053725242614746093750e-01,
--9.3626566717027825959007714118342846632003784179687500e-01,
--9.3572568948108036934740994183812290430068969726562500e-01,
--9.3518350993894772127390524474321864545345306396484375e-01,
--9.3463912981968078064198834908893331885337829589843750e-01,
--9.3409255040425887006705352177959866821765899658203125e-01,
--9.3354377297883628372687780938576906919479370117187500e-01,
--9.3299279883473895669254716267460025846958160400390625e-01,
--9.3243962926846246652701211132807657122611999511718750e-01,
--9.3188426558166814750450157589511945843696594238281250e-01,
--9.3132670908118042607526376741589047014713287353515625e-01,
--9.3076696107898382326339969949913211166858673095703125e-01,
--9.3020502289221906888627700027427636086940765380859375e-01,
--9.2964089584318121417538804962532594799995422363281250e-01,
--9.2907458125931585701806625365861691534519195556640625e-01,
--9.2850608047321558924380724420188926160335540771484375e-01,
--9.2793539482261777617821962849120609462261199951171875e-01,
--9.2736252565040111495164865118567831814289093017578125e-01,
--9.2678747430458185974089246883522719144821166992187500e-01,
--9.2621024213831149030085043705184943974018096923828125e-01,
--9.2563083050987282618393692246172577142715454101562500e-01,
--9.2504924078267758424942712736083194613456726074218750e-01,
--9.2446547432526271492747582669835537672042846679687500e-01,
--9.2387953251128684950543856757576577365398406982421875e-01,
--9.2329141671952763559261256887111812829971313476562500e-01,
--9.2270112833387862849576777080073952674865722656250000e-01,
--9.2210866874334518339395572184002958238124847412109375e-01,
--9.2151403934204190182555294086341746151447296142578125e-01,
--9.2091724152918952306379196670604869723320007324218750e-01,
--9.2031827670911059424696532005327753722667694091796875e-01,
--9.1971714629122747197698117815889418125152587890625000e-01,
--9.1911385169005777040496241170330904424190521240234375e-01,
--9.1850839432521225180749979699612595140933990478515625e-01,
--9.1790077562139060773915844038128852844238281250000000e-01,
--9.1729099700837801734110144025180488824844360351562500e-01,
--9.1667905992104270485043571170535869896411895751953125e-01,
--9.1606496579933183177502087346510961651802062988281250e-01,
--9.1544871608826783315748798486310988664627075195312500e-01,
--9.1483031223794608610688783301156945526599884033203125e-01,
--9.1420975570353080197349981972365640103816986083984375e-01,
--9.1358704794525080750133838591864332556724548339843750e-01,
--9.1296219042839832358282592394971288740634918212890625e-01,
--9.1233518462332285903215733924298547208309173583984375e-01,
--9.1170603200542987831767050010967068374156951904296875e-01,
--9.1107473405517647169205019963555969297885894775390625e-01,
--9.1044129225806724736713704260182566940784454345703125e-01,
--9.0980570810465222209018065768759697675704956054687500e-01,
--9.0916798309052249127404365935944952070713043212890625e-01,
--9.0852811871630623219431299730786122381687164306640625e-01,
--9.0788611648766615047634331858716905117034912109375000e-01,
--9.0724197791529592738157816711463965475559234619140625e-01,
--9.0659570451491544584854409549734555184841156005859375e-01,
--9.0594729780726857004680141471908427774906158447265625e-01,
--9.0529675931811881550714815602987073361873626708984375e-01,
--9.0464409057824624049715112050762400031089782714843750e-01,
--9.0398929312344344921825722849462181329727172851562500e-01,
--9.0333236849451192806981225658091716468334197998046875e-01,
--9.0267331823725882600228942465037107467651367187500000e-01,
--9.0201214390249329078130813286406919360160827636718750e-01,
--9.0134884704602202809553546103416010737419128417968750e-01,
--9.0068342922864685906603199327946640551090240478515625e-01,
--9.0001589201616027935415331739932298660278320312500000e-01,
--8.9934623697934157338096383682568557560443878173828125e-01,
--8.9867446569395403876967520773177966475486755371093750e-01,
--8.9800057974073987931973306331201456487178802490234375e-01,
--8.9732458070541831762767515101586468517780303955078125e-01,
--8.9664647017868037703891559431212954223155975341796875e-01,
--8.9596624975618521791176362967235036194324493408203125e-01,
--8.9528392103855747308216450619511306285858154296875000e-01,
--8.9459948563138280697160098497988656163215637207031250e-01,
--8.9391294514520336367269237598520703613758087158203125e-01,
--8.9322430119551532445854036268428899347782135009765625e-01,
--8.9253355540276468893523542647017166018486022949218750e-01,
--8.9184070939234272312745588351390324532985687255859375e-01,
--8.9114576479458340596551124690449796617031097412109375e-01,
--8.9044872324475798919252156338188797235488891601562500e-01,
--8.8974958638307288794067062553949654102325439453125000e-01,
--8.8904835585466468472759515861980617046356201171875000e-01,
--8.8834503330959635469810109498212113976478576660156250e-01,
--8.8763962040285393495508969863294623792171478271484375e-01,
--8.8693211879434230571206398963113315403461456298828125e-01,
--8.8622253014888063837872778094606474041938781738281250e-01,
--8.8551085613619995307033150311326608061790466308593750e-01,
--8.8479709843093790055945646599866449832916259765625000e-01,
--8.8408125871263498751773113326635211706161499023437500e-01,
--8.8336333866573180095826955948723480105400085449218750e-01,
--8.8264333997956290200903595177805982530117034912109375e-01,
--8.8192126434835504955600526955095119774341583251953125e-01,
--8.8119711347122220423955241130897775292396545410156250e-01,
--8.8047088905216086551774878898868337273597717285156250e-01,
--8.7974259280004740713110322758438996970653533935546875e-01,
--8.7901222642863363621046346452203579246997833251953125e-01,
--8.7827979165654157522880041142343543469905853271484375e-01,
--8.7754529020726124155515890379319898784160614013671875e-01,
--8.7680872380914576247334935032995417714118957519531250e-01,
--8.7607009419540660122294184475322254002094268798828125e-01,
--8.7532940310411100348630952794337645173072814941406250e-01,
--8.7458665227817622422890053712762892246246337890625000e-01,
--8.7384184346536686316397890550433658063411712646484375e-01,
--8.7309497841829020181592113658552989363670349121093750e-01,
--8.7234605889439154058351277853944338858127593994140625e-01,
--8.7159508665595109011547947375220246613025665283203125e-01,
--8.7084206347007908632917860813904553651809692382812500e-01,
--8.7008699110871146054080327303381636738777160644531250e-01,
--8.6932987134860673084091331475065089762210845947265625e-01,
--8.6857070597134100609082452137954533100128173828125000e-01,
--8.6780949676330332298590519712888635694980621337890625e-01,
--8.6704624551569287049801459943410009145736694335937500e-01,
--8.6628095402451310569347242562798783183097839355468750e-01,
--8.6551362409056908919779971256502903997898101806640625e-01,
--8.6474425751946248919210802341694943606853485107421875e-01,
--8.6397285612158680745409355949959717690944671630859375e-01,
--8.6319942171212415971126574731897562742233276367187500e-01,
--8.6242395611104072372654627542942762374877929687500000e-01,
--8.6164646114308141022775089368224143981933593750000000e-01,
--8.6086693863776730939463277536560781300067901611328125e-01,
--8.6008539042939025076606185393757186830043792724609375e-01,
--8.5930181835700847337022878491552546620368957519531250e-01,
--8.5851622426444296198866368285962380468845367431640625e-01,
--8.5772861000027211808571792062139138579368591308593750e-01,
--8.5693897741782876220639764142106287181377410888671875e-01,
--8.5614732837519469388354309558053500950336456298828125e-01,
--8.5535366473519613972342767738155089318752288818359375e-01,
--8.5455798836540053375898651211173273622989654541015625e-01,
--8.5376030113811152144620564286014996469020843505859375e-01,
--8.5296060493036374161590629228157922625541687011718750e-01,
--8.5215890162391982887157837467384524643421173095703125e-01,
--8.5135519310526530656346722025773487985134124755859375e-01,
--8.5054948126560347976266029945691116154193878173828125e-01,
--8.4974176800085265970352566000656224787235260009765625e-01,
--8.4893205521163972449016910104546695947647094726562500e-01,
--8.4812034480329723251657014770898967981338500976562500e-01,
--8.4730663868585853748527370044030249118804931640625000e-01,
--8.4649093877405212626996444669202901422977447509765625e-01,
--8.4567324698729906540251022306620143353939056396484375e-01,
--8.4485356524970722791323396450025029480457305908203125e-01,
--8.4403189549006651937190781609388068318367004394531250e-01,
--8.4320823964184543619637679512379691004753112792968750e-01,
--8.4238259964318595862664551532361656427383422851562500e-01,
--8.4155497743689844369896491116378456354141235351562500e-01,
--8.4072537497045818355445589986629784107208251953125000e-01,
--8.3989379419599963227938133059069514274597167968750000e-01,
--8.3906023707031274216916472141747362911701202392578125e-01,
--8.3822470555483818976938437117496505379676818847656250e-01,
--8.3738720161566204680525515868794173002243041992187500e-01,
--8.3654772722351200542334481724537909030914306640625000e-01,
--8.3570628435375271525487050894298590719699859619140625e-01,
--8.3486287498638012127827323638484813272953033447265625e-01,
--8.3401750110601813315014396721380762755870819091796875e-01,
--8.3317016470191329613470543336006812751293182373046875e-01,
--8.3232086776792968407789885532110929489135742187500000e-01,
--8.3146961230254545771600760417641140520572662353515625e-01,
--8.3061640030884642538211437567952089011669158935546875e-01,
--8.2976123379452304540393470233539119362831115722656250e-01,
--8.2890411477186509703329875264898873865604400634765625e-01,
--8.2804504525775579626412081779562868177890777587890625e-01,
--8.2718402727366913129714021124527789652347564697265625e-01,
--8.2632106284566364529098336788592860102653503417968750e-01,
--8.2545615400437755138085549333482049405574798583984375e-01,
--8.2458930278502529098716422595316544175148010253906250e-01,
--8.2372051122739153861118666100082919001579284667968750e-01,
--8.2284978137582642787606346246320754289627075195312500e-01,
--8.2197711527924155472391021248768083751201629638671875e-01,
--8.2110251499110475936760167314787395298480987548828125e-01,
--8.2022598256943468619795112317660823464393615722656250e-01,
--8.1934752007679712004772909494931809604167938232421875e-01,
--8.1846712958029876894272547360742464661598205566406250e-01,
--8.1758481315158371138807069655740633606910705566406250e-01,
--8.1670057286682795627541509020375087857246398925781250e-01,
--8.1581441080673389176780574416625313460826873779296875e-01,
--8.1492632905652662156370524826343171298503875732421875e-01,
--8.1403632970594852480417102924548089504241943359375000e-01,
--8.1314441484925359393542976249591447412967681884765625e-01,
--8.1225058658520388199519857153063639998435974121093750e-01,
--8.1135484701706384047525943969958461821079254150390625e-01,
--8.1045719825259476820633608440402895212173461914062500e-01,
--8.0955764240405148068902008162694983184337615966796875e-01,
--8.0865618158817509364411080241552554070949554443359375e-01,
--8.0775281792619035847735631250543519854545593261718750e-01,
--8.0684755354379944503051547144423238933086395263671875e-01,
--8.0594039057117639046623480680864304304122924804687500e-01,
--8.0503133114296354655436971370363608002662658691406250e-01,
--8.0412037739826591753455886646406725049018859863281250e-01,
--8.0320753148064494286728631777805276215076446533203125e-01,
--8.0229279553811572167631993579561822116374969482421875e-01,
--8.0137617172314035141056365318945609033107757568359375e-01,
--8.0045766219262282081814419143483974039554595947265625e-01,
--7.9953726910790523518812733527738600969314575195312500e-01,
--7.9861499463476093296776525676250457763671875000000000e-01,
--7.9769084094339115509342263976577669382095336914062500e-01,
--7.9676481020841893876394124163198284804821014404296875e-01,
--7.9583690460888356632551676739240065217018127441406250e-01,
--7.9490712632823701255802006926387548446655273437500000e-01,
--7.9397547755433728333684939570957794785499572753906250e-01,
--7.9304196047944375269622696578153409063816070556640625e-01,
--7.9210657730021227784789061843184754252433776855468750e-01,
--7.9116933021769031419978546182392165064811706542968750e-01,
--7.9023022143731014299561365987756289541721343994140625e-01,
--7.8928925316888587371266794434632174670696258544921875e-01,
--7.8834642762660633863447401381563395261764526367187500e-01,
--7.8740174702903142911480927068623714148998260498046875e-01,
--7.8645521359908598935106738281319849193096160888671875e-01,
--7.8550682956405404322453023269190452992916107177734375e-01,
--7.8455659715557524158668911695713177323341369628906250e-01,
--7.8360451860963842296570192047511227428913116455078125e-01,
--7.8265059616657584040666506552952341735363006591796875e-01,
--7.8169483207105938671332978628925047814846038818359375e-01,
--7.8073722857209459924376915296306833624839782714843750e-01,
--7.7977778792301455368374263343866914510726928710937500e-01,
--7.7881651238147620031071483026607893407344818115234375e-01,
--7.7785340420945325856649787965579889714717864990234375e-01,
--7.7688846567323244229896772594656795263290405273437500e-01,
--7.7592169904340779762463853330700658261775970458984375e-01,
--7.7495310659487393056821247228072024881839752197265625e-01,
--7.7398269060682278741580830683233216404914855957031250e-01,
--7.7301045336273710439911610592389479279518127441406250e-01,
--7.7203639715038452351336673018522560596466064453125000e-01,
--7.7106052426181370673674564386601559817790985107421875e-01,
--7.7008283699334811878145501395920291543006896972656250e-01,
--7.6910333764557969882247334680869244039058685302734375e-01,
--7.6812202852336564085078407515538856387138366699218750e-01,
--7.6713891193582051108990071952575817704200744628906250e-01,
--7.6615399019631291732679301276220940053462982177734375e-01,
--7.6516726562245918064064653663081116974353790283203125e-01,
--7.6417874053611678508701743339770473539829254150390625e-01,
--7.6318841726338126907336345539079047739505767822265625e-01,
--7.6219629813457911993168636399786919355392456054687500e-01,
--7.6120238548426188973650141633697785437107086181640625e-01,
--7.6020668165120242054655363972415216267108917236328125e-01,
--7.5920918897838818306667008073418401181697845458984375e-01,
--7.5820990981301528144342682935530319809913635253906250e-01,
--7.5720884650648478952916775597259402275085449218750000e-01,
--7.5620600141439464625392474772525019943714141845703125e-01,
--7.5520137689653654700094875806826166808605194091796875e-01,
--7.5419497531688939329086451834882609546184539794921875e-01,
--7.5318679904361263144352278686710633337497711181640625e-01,
--7.5217685044904269986432154837530106306076049804687500e-01,
--7.5116513190968658975066318816971033811569213867187500e-01,
--7.5015164580621518375380674115149304270744323730468750e-01,
--7.4913639452345925917597924126312136650085449218750000e-01,
--7.4811938045040371481064767067437060177326202392578125e-01,
--7.4710060598018013244825397123349830508232116699218750e-01,
--7.4608007351006400131865348157589323818683624267578125e-01,
--7.4505778544146605835152286090306006371974945068359375e-01,
--7.4403374417992929057419360105996020138263702392578125e-01,
--7.4300795213512194070659688804880715906620025634765625e-01,
--7.4198041172083106786772077612113207578659057617187500e-01,
--7.4095112535495910588423384979250840842723846435546875e-01,
--7.3992009545951631377391777277807705104351043701171875e-01,
--7.3888732446061522463054416220984421670436859130859375e-01,
--7.3785281478846598268717116297921165823936462402343750e-01,
--7.3681656887737001504490308434469625353813171386718750e-01,
--7.3577858916571359237934757402399554848670959472656250e-01,
--7.3473887809596372111542450511478818953037261962890625e-01,
--7.3369743811466037186619359999895095825195312500000000e-01,
--7.3265427167241281569687316732597537338733673095703125e-01,
--7.3160938122389274074208742604241706430912017822265625e-01,
--7.3056276922782770189002121696830727159976959228515625e-01,
--7.2951443814699701295722888971795327961444854736328125e-01,
--7.2846439044822541841739393930765800178050994873046875e-01,
--7.2741262860237587695166894263820722699165344238281250e-01,
--7.2635915508434589771269429547828622162342071533203125e-01,
--7.2530397237306087898645046152523718774318695068359375e-01,
--7.2424708295146700276490037140320055186748504638671875e-01,
--7.2318848930652768203231062216218560934066772460937500e-01,
--7.2212819392921545613717171363532543182373046875000000e-01,
--7.2106619931450810501161186039098538458347320556640625e-01,
--7.2000250796138187681094677827786654233932495117187500e-01,
--7.1893712237280460453092700845445506274700164794921875e-01,
--7.1787004505573170920484926682547666132450103759765625e-01,
--7.1680127852109964958771115561830811202526092529296875e-01,
--7.1573082528381870570655109986546449363231658935546875e-01,
--7.1465868786276898205755969684105366468429565429687500e-01,
--7.1358486878079374626793196512153372168540954589843750e-01,
--7.1250937056469243469081220609950833022594451904296875e-01,
--7.1143219574521665560240535342018119990825653076171875e-01,
--7.1035334685706241764080459688557311892509460449218750e-01,
--7.0927282643886568891389288182836025953292846679687500e-01,
--7.0819063703319551361659023314132355153560638427734375e-01,
--7.0710678118654768375961339188506826758384704589843750e-01,
--7.0602126144933974316586500208359211683273315429687500e-01,
--7.0493408037590510328840309739462099969387054443359375e-01,
--7.0384524052448504960466379998251795768737792968750000e-01,
--7.0275474445722529992508498253300786018371582031250000e-01,
--7.0166259474016867692114374222001060843467712402343750e-01,
--7.0056879394324844678720864976639859378337860107421875e-01,
--6.9947334464028410039304617384914308786392211914062500e-01,
--6.9837624940897302661113599242526106536388397216796875e-01,
--6.9727751083088662653608480468392372131347656250000000e-01,
--6.9617713149146320805726873004459775984287261962890625e-01,
--6.9507511398000099145377816967084072530269622802734375e-01,
--6.9397146088965400156922669339110143482685089111328125e-01,
--6.9286617481742485136209097618120722472667694091796875e-01,
--6.9175925836415785852295812219381332397460937500000000e-01,
--6.9065071413453460458242716413224115967750549316406250e-01,
--6.8954054473706705152835638727992773056030273437500000e-01,
--6.8842875278409054740080819101422093808650970458984375e-01,
--6.8731534089175938539995058818021789193153381347656250e-01,
--6.8620031168003869925797744144801981747150421142578125e-01,
--6.8508366777270046643621981274918653070926666259765625e-01,
--6.8396541179731562554167112466529943048954010009765625e-01,
--6.8284554638524819214495664709829725325107574462890625e-01,
--6.8172407417164981868751283400342799723148345947265625e-01,
--6.8060099779545324416574203496566042304039001464843750e-01,
--6.7947631989936518870365489419782534241676330566406250e-01,
--6.7835004312986146857156199985183775424957275390625000e-01,
--6.7722217013718055689253105811076238751411437988281250e-01,
--6.7609270357531603412581944212433882057666778564453125e-01,
--6.7496164610201225819707815389847382903099060058593750e-01,
--6.7382900037875625987027206065249629318714141845703125e-01,
--6.7269476907077296878867400664603337645530700683593750e-01,
--6.7155895484701866315901952475542202591896057128906250e-01,
--6.7042156038017319819033446037792600691318511962890625e-01,
--6.6928258834663612031334878338384442031383514404296875e-01,
--6.6814204142651867357471928698942065238952636718750000e-01,
--6.6699992230363758238809168688021600246429443359375000e-01,
--6.6585623366550961144127995794406160712242126464843750e-01,
--6.6471097820334501538042104584746994078159332275390625e-01,
--6.6356415861203987827110495345550589263439178466796875e-01,
--6.6241577759017200577318362775258719921112060546875000e-01,
--6.6126583783999237642348134613712318241596221923828125e-01,
--6.6011434206742047869909129076404497027397155761718750e-01,
--6.5896129298203753865692533508990891277790069580078125e-01,
--6.5780669329707874837254166777711361646652221679687500e-01,
--6.5665054572942904709265121709904633462429046630859375e-01,
--6.5549285299961557171855019987560808658599853515625000e-01,
--6.5433361783180066240106498298700898885726928710937500e-01,
--6.5317284295377708858154619520064443349838256835937500e-01,
--6.5201053109695972231918403849704191088676452636718750e-01,
--6.5084668499638098637660732492804527282714843750000000e-01,
--6.4968130739068319368101356303668580949306488037109375e-01,
--6.4851440102211221905292859446490183472633361816406250e-01,
--6.4734596863651250320259578074910677969455718994140625e-01,
--6.4617601298331661663354452684870921075344085693359375e-01,
--6.4500453681554414941956565598957240581512451171875000e-01,
--6.4383154288979149715288485822384245693683624267578125e-01,
--6.4265703396622675391824941470986232161521911621093750e-01,
--6.4148101280858360606629275935119949281215667724609375e-01,
--6.4030348218415200634012762748170644044876098632812500e-01,
--6.3912444486377595342929680555243976414203643798828125e-01,
--6.3794390362184416609636627981672063469886779785156250e-01,
--6.3676186123628419899489472300047054886817932128906250e-01,
--6.3557832048855600337589066839427687227725982666015625e-01,
--6.3439328416364593188347953400807455182075500488281250e-01,
--6.3320675505005752370379923377186059951782226562500000e-01,
--6.3201873593980917309664846470695920288562774658203125e-01,
--6.3082922962842458147747493057977408170700073242187500e-01,
--6.2963823891492687323534482857212424278259277343750000e-01,
--6.2844576660183315564012218601419590413570404052734375e-01,
--6.2725181549514441581294477146002463996410369873046875e-01,
--6.2605638840434374436938469443703070282936096191406250e-01,
--6.2485948814238645443452924155280925333499908447265625e-01,
--6.2366111752569453052785775071242824196815490722656250e-01,
--6.2246127937414974518048893514787778258323669433593750e-01,
--6.2125997651108799679775529511971399188041687011718750e-01,
--6.2005721176328942867428395402384921908378601074218750e-01,
--6.1885298796097643059255233310977928340435028076171875e-01,
--6.1764730793780397988257391261868178844451904296875000e-01,
--6.1644017453085353519526279342244379222393035888671875e-01,
--6.1523159058062726334270564620965160429477691650390625e-01,
--6.1402155893103871342475486017065122723579406738281250e-01,
--6.1281008242940993024916451759054325520992279052734375e-01,
--6.1159716392646201743588108001858927309513092041015625e-01,
--6.1038280627630936425731533745420165359973907470703125e-01,
--6.0916701233645298430019465740770101547241210937500000e-01,
--6.0794978496777407617202015899238176643848419189453125e-01,
--6.0673112703452480864996232412522658705711364746093750e-01,
--6.0551104140432565614560189715120941400527954101562500e-01,
--6.0428953094815607283152303352835588157176971435546875e-01,
--6.0306659854034805334777047391980886459350585937500000e-01,
--6.0184224705858047066442395589547231793403625488281250e-01,
--6.0061647938386930611898151255445554852485656738281250e-01,
--5.9938929840056476283649544711806811392307281494140625e-01,
--5.9816070699634238394537533167749643325805664062500000e-01,
--5.9693070806219639123924025625456124544143676757812500e-01,
--5.9569930449243313486107354037812910974025726318359375e-01,
--5.9446649918466487605428483220748603343963623046875000e-01,
--5.9323229503980012822239586967043578624725341796875000e-01,
--5.9199669496204110341608384260325692594051361083984375e-01,
--5.9075970185887427543747207892010919749736785888671875e-01,
--5.8952131864106382952428475618944503366947174072265625e-01,
--5.8828154822264577816781638830434530973434448242187500e-01,
--5.8704039352091830217261758662061765789985656738281250e-01,
--5.8579785745643908612123595958109945058822631835937500e-01,
--5.8455394295301532636699448630679398775100708007812500e-01,
--5.8330865293769829094117085332982242107391357421875000e-01,
--5.8206199034077532594722015346633270382881164550781250e-01,
--5.8081395809576497057946653512772172689437866210937500e-01,
--5.7956455913940596591515941327088512480258941650390625e-01,
--5.7831379641165570060223899417906068265438079833984375e-01,
--5.7706167285567955271829987395904026925563812255859375e-01,
--5.7580819141784522763316545024281367659568786621093750e-01,
--5.7455335504771631871534509627963416278362274169921875e-01,
--5.7329716669804253736941745955846272408962249755859375e-01,
--5.7203962932475727054537628646357916295528411865234375e-01,
--5.7078074588696736668680387083441019058227539062500000e-01,
--5.6952051934694714052653807812021113932132720947265625e-01,
--5.6825895267013137868161720689386129379272460937500000e-01,
--5.6699604882510901138203962545958347618579864501953125e-01,
--5.6573181078361345353044953299104236066341400146484375e-01,
--5.6446624152051960709997047160868532955646514892578125e-01,
--5.6319934401383409117158862500218674540519714355468750e-01,
--5.6193112124468924672981984258512966334819793701171875e-01,
--5.6066157619733647532456188855576328933238983154296875e-01,
--5.5939071185913646910847774051944725215435028076171875e-01,
--5.5811853122055632425713156408164650201797485351562500e-01,
--5.5684503727516021509558186153299175202846527099609375e-01,
--5.5557023301960217764872140833176672458648681640625000e-01,
--5.5429412145361989239233935222728177905082702636718750e-01,
--5.5301670558002791189267099980497732758522033691406250e-01,
--5.5173798840470766879917619007756002247333526611328125e-01,
--5.5045797293660492233158265662495978176593780517578125e-01,
--5.4917666218771976627266440118546597659587860107421875e-01,
--5.4789405917310007865239640523213893175125122070312500e-01,
--5.4661016691083541552131919161183759570121765136718750e-01,
--5.4532498842204679689871227310504764318466186523437500e-01,
--5.4403852673088415325963751456583850085735321044921875e-01,
--5.4275078486451600046081011896603740751743316650390625e-01,
--5.4146176585312344453626565154991112649440765380859375e-01,
--5.4017147272989274320309505128534510731697082519531250e-01,
--5.3887990853100886656790180495590902864933013916015625e-01,
--5.3758707629564572716418524578330107033252716064453125e-01,
--5.3629297906596329337247652802034281194210052490234375e-01,
--5.3499761988709726434620961299515329301357269287109375e-01,
--5.3370100180715285276278336823452264070510864257812500e-01,
--5.3240312787719845655232120407163165509700775146484375e-01,
--5.3110400115125533382354205969022586941719055175781250e-01,
--5.2980362468629493832850130274891853332519531250000000e-01,
--5.2850200154222859438846171542536467313766479492187500e-01,
--5.2719913478190127964495559353963471949100494384765625e-01,
--5.2589502747108451963242714555235579609870910644531250e-01,
--5.2458968267846939337317735407850705087184906005859375e-01,
--5.2328310347565676341474727450986392796039581298828125e-01,
--5.2197529293715450027235647212364710867404937744140625e-01,
--5.2066625414036715735477400812669657170772552490234375e-01,
--5.1935599016558942064847315123188309371471405029296875e-01,
--5.1804450409599989146869347678148187696933746337890625e-01,
--5.1673179901765020627379954021307639777660369873046875e-01,
--5.1541787801946326030844147680909372866153717041015625e-01,
--5.1410274419322177230640136258443817496299743652343750e-01,
--5.1278640063356295542007501353509724140167236328125000e-01,
--5.1146885043797019054778729696408845484256744384765625e-01,
--5.1015009670676725317406408066744916141033172607421875e-01,
--5.0883014254310732216168844388448633253574371337890625e-01,
--5.0750899105297098135025635201600380241870880126953125e-01,
--5.0618664534515533937053533009020611643791198730468750e-01,
--5.0486310853126747932861917433911003172397613525390625e-01,
--5.0353838372571813053468758880626410245895385742187500e-01,
--5.0221247404571112138427224635961465537548065185546875e-01,
--5.0088538261124104788990507586277090013027191162109375e-01,
--4.9955711254508194940626708557829260826110839843750000e-01,
--4.9822766697278181302621646864281501621007919311523438e-01,
--4.9689704902265435793040637690864969044923782348632812e-01,
--4.9556526182577298467180071384063921868801116943359375e-01,
--4.9423230851596006152348650175554212182760238647460938e-01,
--4.9289819222978420443226355018850881606340408325195312e-01,
--4.9156291610654995194451544193725567311048507690429688e-01,
--4.9022648328829104835691055086499545723199844360351562e-01,
--4.8888889691976372686710305970336776226758956909179688e-01,
--4.8755016014843632898845271483878605067729949951171875e-01,
--4.8621027612448664001476572593674063682556152343750000e-01,
--4.8486924800079117536810713318118359893560409545898438e-01,
--4.8352707893291868579410675010876730084419250488281250e-01,
--4.8218377207912255233424048128654249012470245361328125e-01,
--4.8083933060033440254343872766185086220502853393554688e-01,
--4.7949375766015334132674752254388295114040374755859375e-01,
--4.7814705642484323089291819997015409171581268310546875e-01,
--4.7679923006332214363567345571937039494514465332031250e-01,
--4.7545028174715575630671082763001322746276855468750000e-01,
--4.7410021465055052214410125088761560618877410888671875e-01,
--4.7274903195034317926470635029545519500970840454101562e-01,
--4.7139673682599791959546564612537622451782226562500000e-01,
--4.7004333245959573073236015261500142514705657958984375e-01,
--4.6868882203582790113571832080197054892778396606445312e-01,
--4.6733320874198824856904366242815740406513214111328125e-01,
--4.6597649576796662529432069277390837669372558593750000e-01,
--4.6461868630623814890867606663960032165050506591796875e-01,
--4.6325978355186037127566578419646248221397399902343750e-01,
--4.6189979070246278691769248325726948678493499755859375e-01,
--4.6053871095823989412210153204796370118856430053710938e-01,
--4.5917654752194464462533574078406672924757003784179688e-01,
--4.5781330359887761893844526639441028237342834472656250e-01,
--4.5644898239688419527837481837195809930562973022460938e-01,
--4.5508358712634394693807848852884490042924880981445312e-01,
--4.5371712100016381441491830628365278244018554687500000e-01,
--4.5234958723377066691639925011259038001298904418945312e-01,
--4.5098098904510430795511410906328819692134857177734375e-01,
--4.4961132965460692823000954376766458153724670410156250e-01,
--4.4824061228522010802421959851926658302545547485351562e-01,
--4.4686884016237421457518053102830890566110610961914062e-01,
--4.4549601651398162971418059896677732467651367187500000e-01,
--4.4412214457042975546130492148222401738166809082031250e-01,
--4.4274722756457041139555030895280651748180389404296875e-01,
--4.4137126873171694807496123758028261363506317138671875e-01,
--4.3999427130963336685098852285591419786214828491210938e-01,
--4.3861623853852760301919033736339770257472991943359375e-01,
--4.3723717366104392079151352845656219869852066040039062e-01,
--4.3585707992225597440238971103099174797534942626953125e-01,
--4.3447596056965603894539640350558329373598098754882812e-01,
--4.3309381885315217930454423367336858063936233520507812e-01,
--4.3171065802505731445748438090959098190069198608398438e-01,
--4.3032648134008250062620959397463593631982803344726562e-01,
--4.2894129205533004789430151504348032176494598388671875e-01,
--4.2755509343028252899898689065594226121902465820312500e-01,
--4.2616788872679989275127354630967602133750915527343750e-01,
--4.2477968120910891691721644747303798794746398925781250e-01,
--4.2339047414379599176825763606757391244173049926757812e-01,
--4.2200027079979951505350754814571700990200042724609375e-01,
--4.2060907444840300861699233792023733258247375488281250e-01,
--4.1921688836322429372316378248797263950109481811523438e-01,
--4.1782371582021249345473279390716925263404846191406250e-01,
--4.1642956009763720803817932392121292650699615478515625e-01,
--4.1503442447608152043869722547242417931556701660156250e-01,
--4.1363831223843511297744157673150766640901565551757812e-01,
--4.1224122666988327612358489204780198633670806884765625e-01,
--4.1084317105790418844790679031575564295053482055664062e-01,
--4.0944414869225775888139651215169578790664672851562500e-01,
--4.0804416286497863231019778140762355178594589233398438e-01,
--4.0664321687036886210364627913804724812507629394531250e-01,
--4.0524131400499036059770219253550749272108078002929688e-01,
--4.0383845756765446299851873845909722149372100830078125e-01,
--4.0243465085941865222451951922266744077205657958984375e-01,
--4.0102989718357567872075719606073107570409774780273438e-01,
--3.9962419984564673258731204441573936492204666137695312e-01,
--3.9821756215337417161848065916274208575487136840820312e-01,
--3.9680998741671075213943709059094544500112533569335938e-01,
--3.9540147894781657589291512522322591394186019897460938e-01,
--3.9399204006104820985356695928203407675027847290039062e-01,
--3.9258167407295146977830313517188187688589096069335938e-01,
--3.9117038430225370415627139664138667285442352294921875e-01,
--3.8975817406985696633725524407054763287305831909179688e-01,
--3.8834504669882663474567152661620639264583587646484375e-01,
--3.8693100551438880385646257309417705982923507690429688e-01,
--3.8551605384391890440909378412470687180757522583007812e-01,
--3.8410019501693498655825464993540663272142410278320312e-01,
--3.8268343236509033689074499307025689631700515747070312e-01,
--3.8126576922216276477328733562899287790060043334960938e-01,
--3.7984720892405143821690671757096424698829650878906250e-01,
--3.7842775480876572613553321389190386980772018432617188e-01,
--3.7700741021641820394094679613772314041852951049804688e-01,
--3.7558617848921704851505865008221007883548736572265625e-01,
--3.7416406297145848869334372466255445033311843872070312e-01,
--3.7274106700951614712380433047655969858169555664062500e-01,
--3.7131719395183776510904749557084869593381881713867188e-01,
--3.6989244714893415588718994513328652828931808471679688e-01,
--3.6846682995337221022680296300677582621574401855468750e-01,
--3.6704034571976695833228632181999273598194122314453125e-01,
--3.6561299780477429788305698821204714477062225341796875e-01,
--3.6418478956708016935905902755621355026960372924804688e-01,
--3.6275572436739733639399219100596383213996887207031250e-01,
--3.6132580556845428354506566392956301569938659667968750e-01,
--3.5989503653498794433218677113472949713468551635742188e-01,
--3.5846342063373703989981322592939250171184539794921875e-01,
--3.5703096123343036616404333472019061446189880371093750e-01,
--3.5559766170478407376620566537894774228334426879882812e-01,
--3.5416352542049045482031033316161483526229858398437500e-01,
--3.5272855575521061544108647467510309070348739624023438e-01,
--3.5129275608556687071626356555498205125331878662109375e-01,
--3.4985612979013536172345766317448578774929046630859375e-01,
--3.4841868024943484227762269256345462054014205932617188e-01,
--3.4698041084592379235118642100133001804351806640625000e-01,
--3.4554132496398903828804805016261525452136993408203125e-01,
--3.4410142598993864737622061511501669883728027343750000e-01,
--3.4266071731199487793162461457541212439537048339843750e-01,
--3.4121920232028274400093437179748434573411941528320312e-01,
--3.3977688440682707327056277790688909590244293212890625e-01,
--3.3833376696554123830296134656236972659826278686523438e-01,
--3.3688985339221994008696015043824445456266403198242188e-01,
--3.3544514708453138096544421387079637497663497924804688e-01,
--3.3399965144200982614108852430945262312889099121093750e-01,
--3.3255336986604450144611178075138013809919357299804688e-01,
--3.3110630575987654022895867456099949777126312255859375e-01,
--3.2965846252858749254599501909979153424501419067382812e-01,
--3.2820984357909233075645261124009266495704650878906250e-01,
--3.2676045232013228858392039910540916025638580322265625e-01,
--3.2531029216226331479688838044239673763513565063476562e-01,
--3.2385936651785307560658111469820141792297363281250000e-01,
--3.2240767880106990794786270271288231015205383300781250e-01,
--3.2095523242787515894036687313928268849849700927734375e-01,
--3.1950203081601541432732460634724702686071395874023438e-01,
--3.1804807738501539304820653342176228761672973632812500e-01,
--3.1659337555616617887466190950362943112850189208984375e-01,
--3.1513792875252255587525951341376639902591705322265625e-01,
--3.1368174039889146209603154602518770843744277954101562e-01,
--3.1222481392182477311081356674549169838428497314453125e-01,
--3.1076715274961203006043319874152075499296188354492188e-01,
--3.0930876031226911537785895234264899045228958129882812e-01,
--3.0784964004153508865258004334464203566312789916992188e-01,
--3.0638979537086102888920891018642578274011611938476562e-01,
--3.0492922973540231845746006911213044077157974243164062e-01,
--3.0346794657201103806443143184878863394260406494140625e-01,
--3.0200594931922852826033931705751456320285797119140625e-01,
--3.0054324141727373209675988618982955813407897949218750e-01,
--2.9907982630804058610252127436979208141565322875976562e-01,
--2.9761570743508619640849133247684221714735031127929688e-01,
--2.9615088824362367780906879488611593842506408691406250e-01,
--2.9468537218051488180137198469310533255338668823242188e-01,
--2.9321916269425901679923640585911925882101058959960938e-01,
--2.9175226323498948399759456151514314115047454833984375e-01,
--2.9028467725446244207532231484947260469198226928710938e-01,
--2.8881640820604936870097390055889263749122619628906250e-01,
--2.8734745954472928897160954875289462506771087646484375e-01,
--2.8587783472708105936277434011572040617465972900390625e-01,
--2.8440753721127215447594949182530399411916732788085938e-01,
--2.8293657045705550290293217585713136941194534301757812e-01,
--2.8146493792575799641753064861404709517955780029296875e-01,
--2.7999264308027305148129926237743347883224487304687500e-01,
--2.7851968938505361483848332682100590318441390991210938e-01,
--2.7704608030610028412965561983583029359579086303710938e-01,
--2.7557181931095836580070113086549099534749984741210938e-01,
--2.7409690986870643980566342179372441023588180541992188e-01,
--2.7262135544994892111247963839559815824031829833984375e-01,
--2.7114515952680778854144705292128492146730422973632812e-01,
--2.6966832557291553484901669435203075408935546875000000e-01,
--2.6819085706340350938603478425648063421249389648437500e-01,
--2.6671275747489853191751763006323017179965972900390625e-01,
--2.6523403028551179039240537349542137235403060913085938e-01,
--2.6375467897483123591584330824844073504209518432617188e-01,
--2.6227470702391414425491689144109841436147689819335938e-01,
--2.6079411791527590258610302953456994146108627319335938e-01,
--2.5931291513288645678159127783146686851978302001953125e-01,
--2.5783110216215909815673512639477849006652832031250000e-01,
--2.5634868248994280293118208646774291992187500000000000e-01,
--2.5486565960451434964539885186241008341312408447265625e-01,
--2.5338203699557060311065015412168577313423156738281250e-01,
--2.5189781815421724564529881718044634908437728881835938e-01,
--2.5041300657296539089458065063809044659137725830078125e-01,
--2.4892760574572014853345081064617261290550231933593750e-01,
--2.4744161916777313026116758010175544768571853637695312e-01,
--2.4595505033579515008490545824315631762146949768066406e-01,
--2.4446790274782453922242098087735939770936965942382812e-01,
--2.4298017990326412074431061682844301685690879821777344e-01,
--2.4149188530286941345437412564933765679597854614257812e-01,
--2.4000302244874138768437887847539968788623809814453125e-01,
--2.3851359484431819413252640060818521305918693542480469e-01,
--2.3702360599436766985803615170880220830440521240234375e-01,
--2.3553305940497579196168942416989011690020561218261719e-01,
--2.3404195858354356896136039267730666324496269226074219e-01,
--2.3255030703877521691680385629297234117984771728515625e-01,
--2.3105810828067094297999517493735766038298606872558594e-01,
--2.2956536582051942363413843395392177626490592956542969e-01,
--2.2807208317088611959633226433652453124523162841796875e-01,
--2.2657826384561022270425212354894028976559638977050781e-01,
--2.2508391135979291530766488449444295838475227355957031e-01,
--2.2358902922978990401858823133807163685560226440429688e-01,
--2.2209362097320328732763528023497201502323150634765625e-01,
--2.2059769010887397833187151263700798153877258300781250e-01,
--2.1910124015687010290420744240691419690847396850585938e-01,
--2.1760427463848378004662720286432886496186256408691406e-01,
--2.1610679707621949230400559827103279531002044677734375e-01,
--2.1460881099378661951426749965321505442261695861816406e-01,
--2.1311031991609191704739600936591159552335739135742188e-01,
--2.1161132736922796948597635946498485282063484191894531e-01,
--2.1011183688046985995612203623750247061252593994140625e-01,
--2.0861185197826356829686744731588987633585929870605469e-01,
--2.0711137619221847705475170187128242105245590209960938e-01,
--2.0561041305309901705555830631055869162082672119140625e-01,
--2.0410896609281733993235263824317371472716331481933594e-01,
--2.0260703884442143873911845730617642402648925781250000e-01,
--2.0110463484209206708186457035480998456478118896484375e-01,
--1.9960175762113097075456380480318330228328704833984375e-01,
--1.9809841071795342148931240444653667509555816650390625e-01,
--1.9659459767008077846206504091242095455527305603027344e-01,
--1.9509032201612866441742255574354203417897224426269531e-01,
--1.9358558729580385704416300995944766327738761901855469e-01,
--1.9208039704989252061118065739719895645976066589355469e-01,
--1.9057475482025268420649410927580902352929115295410156e-01,
--1.8906866414980597057571287678001681342720985412597656e-01,
--1.8756212858253007436104553562472574412822723388671875e-01,
--1.8605515166344696598166308376676170155405998229980469e-01,
--1.8454773693861975525365437533764634281396865844726562e-01,
--1.8303988795514095078154070961318211629986763000488281e-01,
--1.8153160826112482717498153306223684921860694885253906e-01,
--1.8002290140570006982123629768466344103217124938964844e-01,
--1.7851377093899792325437658746523084118962287902832031e-01,
--1.7700422041214899926409032104857033118605613708496094e-01,
--1.7549425337727150853162072507984703406691551208496094e-01,
--1.7398387338746373886877449876919854432344436645507812e-01,
--1.7247308399679572854523712521768175065517425537109375e-01,
--1.7096188876030168901642980472388444468379020690917969e-01,
--1.6945029123396829207059965938242385163903236389160156e-01,
--1.6793829497473133915974585761432535946369171142578125e-01,
--1.6642590354046410405786105002334807068109512329101562e-01,
--1.6491312048996975558878830270259641110897064208984375e-01,
--1.6339994938297378035407803054113173857331275939941406e-01,
--1.6188639378011224212450258619355736300349235534667969e-01,
--1.6037245724292850668213361586822429671883583068847656e-01,
--1.5885814333386152896743226392572978511452674865722656e-01,
--1.5734345561623819254037925929878838360309600830078125e-01,
--1.5582839765426501066336584244709229096770286560058594e-01,
--1.5431297301302057678462631429283646866679191589355469e-01,
--1.5279718525844374066302577830356312915682792663574219e-01,
--1.5128103795733038872128872753819450736045837402343750e-01,
--1.4976453467732150914848432421422330662608146667480469e-01,
--1.4824767898689589218363948930345941334962844848632812e-01,
--1.4673047445536230304341529517841991037130355834960938e-01,
--1.4521292465284785233592401709756813943386077880859375e-01,
--1.4369503315029469314723087336460594087839126586914062e-01,
--1.4217680351944814165499053615349112078547477722167969e-01,
--1.4065823933284915536745529607287608087062835693359375e-01,
--1.3913934416382597869521475786314113065600395202636719e-01,
--1.3762012158648653792347715807409258559346199035644531e-01,
--1.3610057517570653407013026026106672361493110656738281e-01,
--1.3458070850712636201684802017553010955452919006347656e-01,
--1.3306052515713906458927340281661599874496459960937500e-01,
--1.3154002870288294957390462514013051986694335937500000e-01,
--1.3001922272223392917922524247842375189065933227539062e-01,
--1.2849811079379358513818942810758017003536224365234375e-01,
--1.2697669649688611559490425406693248078227043151855469e-01,
--1.2545498341154631694038812383951153606176376342773438e-01,
--1.2393297511851208980715455254539847373962402343750000e-01,
--1.2241067519921595974086159230864723213016986846923828e-01,
--1.2088808723577756931710780463617993518710136413574219e-01,
--1.1936521481099168773276630872715031728148460388183594e-01,
--1.1784206150832514381487925447800080291926860809326172e-01,
--1.1631863091190476622305283171954215504229068756103516e-01,
--1.1479492660650993107740447385367588140070438385009766e-01,
--1.1327095217756491529748075208772206678986549377441406e-01,
--1.1174671121112700333810607844498008489608764648437500e-01,
--1.1022220729388330917597471625413163565099239349365234e-01,
--1.0869744401313879977877263627306092530488967895507812e-01,
--1.0717242495680877334418568125329329632222652435302734e-01,
--1.0564715371341037997154899130691774189472198486328125e-01,
--1.0412163387205507214527955284211202524602413177490234e-01,
--1.0259586902243661432621024687250610440969467163085938e-01,
--1.0106986275482798820490870639332570135593414306640625e-01,
--9.9543618660069346781860133432928705587983131408691406e-02,
--9.8017140329560450973112040173873538151383399963378906e-02,
--9.6490431355253161727070221331814536824822425842285156e-02,
--9.4963495329639407982469379021495115011930465698242188e-02,
--9.3436335845748036410540748875064309686422348022460938e-02,
--9.1908956497132821006346148351440206170082092285156250e-02,
--9.0381360877864913572210525671835057437419891357421875e-02,
--8.8853552582524364389371385186677798628807067871093750e-02,
--8.7325535206192558823623528496682411059737205505371094e-02,
--8.5797312344440226916653102762211346998810768127441406e-02,
--8.4268887593324237617053995563765056431293487548828125e-02,
--8.2740264549375705516176537912542698904871940612792969e-02,
--8.1211446809592288675894167226942954584956169128417969e-02,
--7.9682437971430694623187207525916164740920066833496094e-02,
--7.8153241632794648308113494294957490637898445129394531e-02,
--7.6623861392031741845976000604423461481928825378417969e-02,
--7.5094300847921402475293461975525133311748504638671875e-02,
--7.3564563599667356919020733130309963598847389221191406e-02,
--7.2034653246889096545046982100757304579019546508789062e-02,
--7.0504573389614355605203854793217033147811889648437500e-02,
--6.8974327628267079193236099854402709752321243286132812e-02,
--6.7443919563664231353605771346337860450148582458496094e-02,
--6.5913352797003832428401892684632912278175354003906250e-02,
--6.4382630929857312396258350872813025489449501037597656e-02,
--6.2851757564161989111362061066756723448634147644042969e-02,
--6.1320736302208994628060167997318785637617111206054688e-02,
--5.9789570746640131881921575995875173248350620269775391e-02,
--5.8258264500435856525495381674772943370044231414794922e-02,
--5.6726821166907685778379999419485102407634258270263672e-02,
--5.5195244349689712159978682848304742947220802307128906e-02,
--5.3663537652731026217356458118956652469933032989501953e-02,
--5.2131704680283656727635133165676961652934551239013672e-02,
--5.0599749036899455134630443353671580553054809570312500e-02,
--4.9067674327418028812353156808967469260096549987792969e-02,
--4.7535484156959156853972103817795868963003158569335938e-02,
--4.6003182130915205860777206225975533016026020050048828e-02,
--4.4470771854939084022362294490449130535125732421875000e-02,
--4.2938256934941083919898829890371416695415973663330078e-02,
--4.1405640977076836606318721578645636327564716339111328e-02,
--3.9872927587739748211959067702991887927055358886718750e-02,
--3.8340120373552472043954253422270994633436203002929688e-02,
--3.6807222941359331314092884213096112944185733795166016e-02,
--3.5274238898214294035682314643054269254207611083984375e-02,
--3.3741171851377760315671139323967508971691131591796875e-02,
--3.2208025408304599701558856850169831886887550354003906e-02,
--3.0674803176636483703632052311149891465902328491210938e-02,
--2.9141508764194308522821330598162603564560413360595703e-02,
--2.7608145778966163008671941270222305320203304290771484e-02,
--2.6074717829104161054276644904348358977586030960083008e-02,
--2.4541228522912388737564626239873177837580442428588867e-02,
--2.3007681468839309701923667716982890851795673370361328e-02,
--2.1474080275469285827849574843639857135713100433349609e-02,
--1.9940428551514944449651878244367253500968217849731445e-02,
--1.8406729905805163660659218294313177466392517089843750e-02,
--1.6872987947281894299811355608653684612363576889038086e-02,
--1.5339206284988120970735892001357569824904203414916992e-02,
--1.3805388528060250075135684255656087771058082580566406e-02,
--1.2271538285720511723964065708969428669661283493041992e-02,
--1.0737659167264915552331139281250216299667954444885254e-02,
--9.2037547820600831144366438252291118260473012924194336e-03,
--7.6698287395311993616675572127405757782980799674987793e-03,
--6.1358846491544162884967938964564382331445813179016113e-03,
--4.6019261204483501853657045899126387666910886764526367e-03,
--3.0679567629664826824975598640321550192311406135559082e-03,
--1.5339801862851104932716772566436702618375420570373535e-03,
--1.8369701987210296875011296034045003113559498615810217e-16,
-1.5339801862847431655756391677414285368286073207855225e-03,
-3.0679567629661149211206527809281396912410855293273926e-03,
-4.6019261204479824239887975068086234387010335922241211e-03,
-6.1358846491540485271198868133524229051545262336730957e-03,
-7.6698287395308316002906501296365604503080248832702637e-03,
-9.2037547820597153530597367421250964980572462081909180e-03,
-1.0737659167264547790954232198146200971677899360656738e-02,
-1.2271538285720143962587158625865413341671228408813477e-02,
-1.3805388528059882313758777172552072443068027496337891e-02,
-1.5339206284987753209358984918253554496914148330688477e-02,
-1.6872987947281526538434448525549669284373521804809570e-02,
-1.8406729905804795899282311211209162138402462005615234e-02,
-1.9940428551514576688274971161263238172978162765502930e-02,
-2.1474080275468918066472667760535841807723045349121094e-02,
-2.3007681468838945409993712587493064347654581069946289e-02,
-2.4541228522912020976187719156769162509590387344360352e-02,
-2.6074717829103793292899737821244343649595975875854492e-02,
-2.7608145778965795247295034187118289992213249206542969e-02,
-2.9141508764193940761444423515058588236570358276367188e-02,
-3.0674803176636115942255145228045876137912273406982422e-02,
-3.2208025408304231940181949767065816558897495269775391e-02,
-3.3741171851377399493188136148091871291399002075195312e-02,
-3.5274238898213926274305407559950253926217555999755859e-02,
-3.6807222941358963552715977129992097616195678710937500e-02,
-3.8340120373552104282577346339166979305446147918701172e-02,
-3.9872927587739380450582160619887872599065303802490234e-02,
-4.1405640977076468844941814495541620999574661254882812e-02,
-4.2938256934940716158521922807267401367425918579101562e-02,
-4.4470771854938716260985387407345115207135677337646484e-02,
-4.6003182130914845038294203050099895335733890533447266e-02,
-4.7535484156958796031489100641920231282711029052734375e-02,
-4.9067674327417661050976249725863453932106494903564453e-02,
-5.0599749036899087373253536270567565225064754486083984e-02,
-5.2131704680283288966258226082572946324944496154785156e-02,
-5.3663537652730658455979551035852637141942977905273438e-02,
-5.5195244349689344398601775765200727619230747222900391e-02,
-5.6726821166907318017003092336381087079644203186035156e-02,
-5.8258264500435488764118474591668928042054176330566406e-02,
-5.9789570746639764120544668912771157920360565185546875e-02,
-6.1320736302208626866683260914214770309627056121826172e-02,
-6.2851757564161628288879057890881085768342018127441406e-02,
-6.4382630929856951573775347696937387809157371520996094e-02,
-6.5913352797003457728131081694300519302487373352050781e-02,
-6.7443919563663870531122768170462222769856452941894531e-02,
-6.8974327628266718370753096678527072072029113769531250e-02,
-7.0504573389613994782720851617341395467519760131835938e-02,
-7.2034653246888721844776171110424911603331565856933594e-02,
-7.3564563599666982218749922139977570623159408569335938e-02,
-7.5094300847921041652810458799649495631456375122070312e-02,
-7.6623861392031381023492997428547823801636695861816406e-02,
-7.8153241632794287485630491119081852957606315612792969e-02,
-7.9682437971430333800704204350040527060627937316894531e-02,
-8.1211446809591913975623356236610561609268188476562500e-02,
-8.2740264549375330815905726922210305929183959960937500e-02,
-8.4268887593323876794570992387889418751001358032226562e-02,
-8.5797312344439852216382291771878954023122787475585938e-02,
-8.7325535206192198001140525320806773379445075988769531e-02,
-8.8853552582524003566888382010802160948514938354492188e-02,
-9.0381360877864538871939714681502664461731910705566406e-02,
-9.1908956497132446306075337361107813194394111633300781e-02,
-9.3436335845747661710269937884731916710734367370605469e-02,
-9.4963495329639047159986375845619477331638336181640625e-02,
-9.6490431355252800904587218155938899144530296325683594e-02,
-9.8017140329560090150629036997997900471091270446777344e-02,
-9.9543618660068972081589322442596312612295150756835938e-02,
-1.0106986275482762738242570321745006367564201354980469e-01,
-1.0259586902243625350372724369663046672940254211425781e-01,
-1.0412163387205469744500874185177963227033615112304688e-01,
-1.0564715371341001914906598813104210421442985534667969e-01,
-1.0717242495680841252170267807741765864193439483642578e-01,
-1.0869744401313843895628963309718528762459754943847656e-01,
-1.1022220729388293447570390526379924267530441284179688e-01,
-1.1174671121112664251562307526910444721579551696777344e-01,
-1.1327095217756455447499774891184642910957336425781250e-01,
-1.1479492660650957025492147067780024372041225433349609e-01,
-1.1631863091190440540056982854366651736199855804443359e-01,
-1.1784206150832478299239625130212516523897647857666016e-01,
-1.1936521481099132691028330555127467960119247436523438e-01,
-1.2088808723577719461683699364584754221141338348388672e-01,
-1.2241067519921559891837858913277159444987773895263672e-01,
-1.2393297511851172898467154936952283605933189392089844e-01,
-1.2545498341154595611790512066363589838147163391113281e-01,
-1.2697669649688575477242125089105684310197830200195312e-01,
-1.2849811079379322431570642493170453235507011413574219e-01,
-1.3001922272223354060116662367363460361957550048828125e-01,
-1.3154002870288258875142162196425488218665122985839844e-01,
-1.3306052515713870376679039964074036106467247009277344e-01,
-1.3458070850712597343878940137074096128344535827636719e-01,
-1.3610057517570617324764725708519108593463897705078125e-01,
-1.3762012158648617710099415489821694791316986083984375e-01,
-1.3913934416382561787273175468726549297571182250976562e-01,
-1.4065823933284879454497229289700044319033622741699219e-01,
-1.4217680351944778083250753297761548310518264770507812e-01,
-1.4369503315029433232474787018873030319809913635253906e-01,
-1.4521292465284749151344101392169250175356864929199219e-01,
-1.4673047445536194222093229200254427269101142883300781e-01,
-1.4824767898689553136115648612758377566933631896972656e-01,
-1.4976453467732114832600132103834766894578933715820312e-01,
-1.5128103795733000014323010873340535908937454223632812e-01,
-1.5279718525844337984054277512768749147653579711914062e-01,
-1.5431297301302021596214331111696083098649978637695312e-01,
-1.5582839765426462208530722364230314269661903381347656e-01,
-1.5734345561623780396232064049399923533201217651367188e-01,
-1.5885814333386116814494926074985414743423461914062500e-01,
-1.6037245724292814585965061269234865903854370117187500e-01,
-1.6188639378011188130201958301768172532320022583007812e-01,
-1.6339994938297341953159502736525610089302062988281250e-01,
-1.6491312048996939476630529952672077342867851257324219e-01,
-1.6642590354046374323537804684747243300080299377441406e-01,
-1.6793829497473097833726285443844972178339958190917969e-01,
-1.6945029123396793124811665620654821395874023437500000e-01,
-1.7096188876030132819394680154800880700349807739257812e-01,
-1.7247308399679536772275412204180611297488212585449219e-01,
-1.7398387338746337804629149559332290664315223693847656e-01,
-1.7549425337727114770913772190397139638662338256835938e-01,
-1.7700422041214863844160731787269469350576400756835938e-01,
-1.7851377093899756243189358428935520350933074951171875e-01,
-1.8002290140569970899875329450878780335187911987304688e-01,
-1.8153160826112446635249852988636121153831481933593750e-01,
-1.8303988795514058995905770643730647861957550048828125e-01,
-1.8454773693861939443117137216177070513367652893066406e-01,
-1.8605515166344660515918008059088606387376785278320312e-01,
-1.8756212858252971353856253244885010644793510437011719e-01,
-1.8906866414980560975322987360414117574691772460937500e-01,
-1.9057475482025232338401110609993338584899902343750000e-01,
-1.9208039704989215978869765422132331877946853637695312e-01,
-1.9358558729580349622168000678357202559709548950195312e-01,
-1.9509032201612830359493955256766639649868011474609375e-01,
-1.9659459767008041763958203773654531687498092651367188e-01,
-1.9809841071795306066682940127066103741526603698730469e-01,
-1.9960175762113060993208080162730766460299491882324219e-01,
-2.0110463484209170625938156717893434688448905944824219e-01,
-2.0260703884442107791663545413030078634619712829589844e-01,
-2.0410896609281697910986963506729807704687118530273438e-01,
-2.0561041305309865623307530313468305394053459167480469e-01,
-2.0711137619221811623226869869540678337216377258300781e-01,
-2.0861185197826320747438444414001423865556716918945312e-01,
-2.1011183688046949913363903306162683293223381042480469e-01,
-2.1161132736922760866349335628910921514034271240234375e-01,
-2.1311031991609155622491300619003595784306526184082031e-01,
-2.1460881099378625869178449647733941674232482910156250e-01,
-2.1610679707621913148152259509515715762972831726074219e-01,
-2.1760427463848341922414419968845322728157043457031250e-01,
-2.1910124015686974208172443923103855922818183898925781e-01,
-2.2059769010887361750938850946113234385848045349121094e-01,
-2.2209362097320292650515227705909637734293937683105469e-01,
-2.2358902922978954319610522816219599917531013488769531e-01,
-2.2508391135979255448518188131856732070446014404296875e-01,
-2.2657826384560986188176912037306465208530426025390625e-01,
-2.2807208317088575877384926116064889356493949890136719e-01,
-2.2956536582051906281165543077804613858461380004882812e-01,
-2.3105810828067058215751217176148202270269393920898438e-01,
-2.3255030703877488384989646874601021409034729003906250e-01,
-2.3404195858354320813887738950143102556467056274414062e-01,
-2.3553305940497545889478203662292798981070518493652344e-01,
-2.3702360599436730903555314853292657062411308288574219e-01,
-2.3851359484431783331004339743230957537889480590820312e-01,
-2.4000302244874102686189587529952405020594596862792969e-01,
-2.4149188530286905263189112247346201911568641662597656e-01,
-2.4298017990326375992182761365256737917661666870117188e-01,
-2.4446790274782417839993797770148376002907752990722656e-01,
-2.4595505033579478926242245506728067994117736816406250e-01,
-2.4744161916777276943868457692587981000542640686035156e-01,
-2.4892760574571978771096780747029697522521018981933594e-01,
-2.5041300657296505782767326309112831950187683105468750e-01,
-2.5189781815421691257839142963348422199487686157226562e-01,
-2.5338203699557027004374276657472364604473114013671875e-01,
-2.5486565960451396106734023305762093514204025268554688e-01,
-2.5634868248994246986427469892078079283237457275390625e-01,
-2.5783110216215870957867650758998934179544448852539062e-01,
-2.5931291513288612371468389028450474143028259277343750e-01,
-2.6079411791527551400804441072978079319000244140625000e-01,
-2.6227470702391381118800950389413628727197647094726562e-01,
-2.6375467897483084733778468944365158677101135253906250e-01,
-2.6523403028551145732549798594845924526453018188476562e-01,
-2.6671275747489819885061024251626804471015930175781250e-01,
-2.6819085706340312080797616545169148594141006469726562e-01,
-2.6966832557291520178210930680506862699985504150390625e-01,
-2.7114515952680739996338843411649577319622039794921875e-01,
-2.7262135544994853253442101959080900996923446655273438e-01,
-2.7409690986870610673875603424676228314638137817382812e-01,
-2.7557181931095803273379374331852886825799942016601562e-01,
-2.7704608030609995106274823228886816650629043579101562e-01,
-2.7851968938505328177157593927404377609491348266601562e-01,
-2.7999264308027271841439187483047135174274444580078125e-01,
-2.8146493792575760783947202980925794690847396850585938e-01,
-2.8293657045705511432487355705234222114086151123046875e-01,
-2.8440753721127176589789087302051484584808349609375000e-01,
-2.8587783472708067078471572131093125790357589721679688e-01,
-2.8734745954472890039355092994810547679662704467773438e-01,
-2.8881640820604903563406651301193051040172576904296875e-01,
-2.9028467725446205349726369604468345642089843750000000e-01,
-2.9175226323498915093068717396818101406097412109375000e-01,
-2.9321916269425868373232901831215713173151016235351562e-01,
-2.9468537218051449322331336588831618428230285644531250e-01,
-2.9615088824362328923101017608132679015398025512695312e-01,
-2.9761570743508586334158394492988009005784988403320312e-01,
-2.9907982630804025303561388682282995432615280151367188e-01,
-3.0054324141727339902985249864286743104457855224609375e-01,
-3.0200594931922813968228069825272541493177413940429688e-01,
-3.0346794657201070499752404430182650685310363769531250e-01,
-3.0492922973540198539055268156516831368207931518554688e-01,
-3.0638979537086064031115029138163663446903228759765625e-01,
-3.0784964004153475558567265579767990857362747192382812e-01,
-3.0930876031226872679980033353785984218120574951171875e-01,
-3.1076715274961164148237457993673160672187805175781250e-01,
-3.1222481392182438453275494794070255011320114135742188e-01,
-3.1368174039889112902912415847822558134794235229492188e-01,
-3.1513792875252216729720089460897725075483322143554688e-01,
-3.1659337555616579029660329069884028285741806030273438e-01,
-3.1804807738501500447014791461697313934564590454101562e-01,
-3.1950203081601508126041721880028489977121353149414062e-01,
-3.2095523242787477036230825433449354022741317749023438e-01,
-3.2240767880106957488095531516592018306255340576171875e-01,
-3.2385936651785274253967372715123929083347320556640625e-01,
-3.2531029216226292621882976163760758936405181884765625e-01,
-3.2676045232013195551701301155844703316688537597656250e-01,
-3.2820984357909199768954522369313053786754608154296875e-01,
-3.2965846252858715947908763155282940715551376342773438e-01,
-3.3110630575987620716205128701403737068176269531250000e-01,
-3.3255336986604416837920439320441801100969314575195312e-01,
-3.3399965144200949307418113676249049603939056396484375e-01,
-3.3544514708453104789853682632383424788713455200195312e-01,
-3.3688985339221960702005276289128232747316360473632812e-01,
-3.3833376696554084972490272775758057832717895507812500e-01,
-3.3977688440682674020365539035992696881294250488281250e-01,
-3.4121920232028241093402698425052221864461898803710938e-01,
-3.4266071731199454486471722702844999730587005615234375e-01,
-3.4410142598993831430931322756805457174777984619140625e-01,
-3.4554132496398870522114066261565312743186950683593750e-01,
-3.4698041084592345928427903345436789095401763916015625e-01,
-3.4841868024943450921071530501649249345064163208007812e-01,
-3.4985612979013502865655027562752366065979003906250000e-01,
-3.5129275608556653764935617800801992416381835937500000e-01,
-3.5272855575521028237417908712814096361398696899414062e-01,
-3.5416352542049006624225171435682568699121475219726562e-01,
-3.5559766170478374069929827783198561519384384155273438e-01,
-3.5703096123343003309713594717322848737239837646484375e-01,
-3.5846342063373670683290583838243037462234497070312500e-01,
-3.5989503653498761126527938358776737004518508911132812e-01,
-3.6132580556845389496700704512477386742830276489257812e-01,
-3.6275572436739700332708480345900170505046844482421875e-01,
-3.6418478956707983629215164000925142318010330200195312e-01,
-3.6561299780477396481614960066508501768112182617187500e-01,
-3.6704034571976656975422770301520358771085739135742188e-01,
-3.6846682995337187715989557545981369912624359130859375e-01,
-3.6989244714893382282028255758632440119981765747070312e-01,
-3.7131719395183737653098887676605954766273498535156250e-01,
-3.7274106700951581405689694292959757149219512939453125e-01,
-3.7416406297145815562643633711559232324361801147460938e-01,
-3.7558617848921671544815126253524795174598693847656250e-01,
-3.7700741021641787087403940859076101332902908325195312e-01,
-3.7842775480876539306862582634494174271821975708007812e-01,
-3.7984720892405110514999933002400211989879608154296875e-01,
-3.8126576922216243170637994808203075081110000610351562e-01,
-3.8268343236509000382383760552329476922750473022460938e-01,
-3.8410019501693459798019603113061748445034027099609375e-01,
-3.8551605384391857134218639657774474471807479858398438e-01,
-3.8693100551438847078955518554721493273973464965820312e-01,
-3.8834504669882630167876413906924426555633544921875000e-01,
-3.8975817406985663327034785652358550578355789184570312e-01,
-3.9117038430225337108936400909442454576492309570312500e-01,
-3.9258167407295113671139574762491974979639053344726562e-01,
-3.9399204006104787678665957173507194966077804565429688e-01,
-3.9540147894781624282600773767626378685235977172851562e-01,
-3.9680998741671041907252970304398331791162490844726562e-01,
-3.9821756215337383855157327161577995866537094116210938e-01,
-3.9962419984564639952040465686877723783254623413085938e-01,
-4.0102989718357534565384980851376894861459732055664062e-01,
-4.0243465085941831915761213167570531368255615234375000e-01,
-4.0383845756765412993161135091213509440422058105468750e-01,
-4.0524131400499002753079480498854536563158035278320312e-01,
-4.0664321687036852903673889159108512103557586669921875e-01,
-4.0804416286497829924329039386066142469644546508789062e-01,
-4.0944414869225737030333789334690663963556289672851562e-01,
-4.1084317105790385538099940276879351586103439331054688e-01,
-4.1224122666988294305667750450083985924720764160156250e-01,
-4.1363831223843477991053418918454553931951522827148438e-01,
-4.1503442447608118737178983792546205222606658935546875e-01,
-4.1642956009763687497127193637425079941749572753906250e-01,
-4.1782371582021216038782540636020712554454803466796875e-01,
-4.1921688836322396065625639494101051241159439086914062e-01,
-4.2060907444840267555008495037327520549297332763671875e-01,
-4.2200027079979918198660016059875488281250000000000000e-01,
-4.2339047414379565870135024852061178535223007202148438e-01,
-4.2477968120910863936146029118390288203954696655273438e-01,
-4.2616788872679955968436615876271389424800872802734375e-01,
-4.2755509343028219593207950310898013412952423095703125e-01,
-4.2894129205532971482739412749651819467544555664062500e-01,
-4.3032648134008216755930220642767380923032760620117188e-01,
-4.3171065802505698139057699336262885481119155883789062e-01,
-4.3309381885315184623763684612640645354986190795898438e-01,
-4.3447596056965570587848901595862116664648056030273438e-01,
-4.3585707992225564133548232348402962088584899902343750e-01,
-4.3723717366104358772460614090960007160902023315429688e-01,
-4.3861623853852726995228294981643557548522949218750000e-01,
-4.3999427130963303378408113530895207077264785766601562e-01,
-4.4137126873171661500805385003332048654556274414062500e-01,
-4.4274722756457013383979415266367141157388687133789062e-01,
-4.4412214457042942239439753393526189029216766357421875e-01,
-4.4549601651398129664727321141981519758701324462890625e-01,
-4.4686884016237388150827314348134677857160568237304688e-01,
-4.4824061228521977495731221097230445593595504760742188e-01,
-4.4961132965460659516310215622070245444774627685546875e-01,
-4.5098098904510403039935795277415309101343154907226562e-01,
-4.5234958723377038936064309382345527410507202148437500e-01,
-4.5371712100016353685916214999451767653226852416992188e-01,
-4.5508358712634361387117110098188277333974838256835938e-01,
-4.5644898239688386221146743082499597221612930297851562e-01,
-4.5781330359887728587153787884744815528392791748046875e-01,
-4.5917654752194436706957958449493162333965301513671875e-01,
-4.6053871095823956105519414450100157409906387329101562e-01,
-4.6189979070246245385078509571030735969543457031250000e-01,
-4.6325978355186003820875839664950035512447357177734375e-01,
-4.6461868630623781584176867909263819456100463867187500e-01,
-4.6597649576796629222741330522694624960422515869140625e-01,
-4.6733320874198791550213627488119527697563171386718750e-01,
-4.6868882203582756806881093325500842183828353881835938e-01,
-4.7004333245959539766545276506803929805755615234375000e-01,
-4.7139673682599758652855825857841409742832183837890625e-01,
-4.7274903195034284619779896274849306792020797729492188e-01,
-4.7410021465055024458834509459848050028085708618164062e-01,
-4.7545028174715547875095467134087812155485153198242188e-01,
-4.7679923006332186607991729943023528903722763061523438e-01,
-4.7814705642484289782601081242319196462631225585937500e-01,
-4.7949375766015300825984013499692082405090332031250000e-01,
-4.8083933060033406947653134011488873511552810668945312e-01,
-4.8218377207912227477848432499740738421678543090820312e-01,
-4.8352707893291835272719936256180517375469207763671875e-01,
-4.8486924800079089781235097689204849302768707275390625e-01,
-4.8621027612448636245900956964760553091764450073242188e-01,
-4.8755016014843599592154532729182392358779907226562500e-01,
-4.8888889691976339380019567215640563517808914184570312e-01,
-4.9022648328829071529000316331803333014249801635742188e-01,
-4.9156291610654967438875928564812056720256805419921875e-01,
-4.9289819222978387136535616264154668897390365600585938e-01,
-4.9423230851595972845657911420857999473810195922851562e-01,
-4.9556526182577265160489332629367709159851074218750000e-01,
-4.9689704902265402486349898936168756335973739624023438e-01,
-4.9822766697278147995930908109585288912057876586914062e-01,
-4.9955711254508167185051092928915750235319137573242188e-01,
-5.0088538261124071482299768831580877304077148437500000e-01,
-5.0221247404571089933966732132830657064914703369140625e-01,
-5.0353838372571779746778020125930197536945343017578125e-01,
-5.0486310853126714626171178679214790463447570800781250e-01,
-5.0618664534515500630362794254324398934841156005859375e-01,
-5.0750899105297064828334896446904167532920837402343750e-01,
-5.0883014254310698909478105633752420544624328613281250e-01,
-5.1015009670676692010715669312048703432083129882812500e-01,
-5.1146885043796985748087990941712632775306701660156250e-01,
-5.1278640063356262235316762598813511431217193603515625e-01,
-5.1410274419322155026179643755313009023666381835937500e-01,
-5.1541787801946292724153408926213160157203674316406250e-01,
-5.1673179901764998422919461518176831305027008056640625e-01,
-5.1804450409599955840178608923451974987983703613281250e-01,
-5.1935599016558919860386822620057500898838043212890625e-01,
-5.2066625414036682428786662057973444461822509765625000e-01,
-5.2197529293715416720544908457668498158454895019531250e-01,
-5.2328310347565643034783988696290180087089538574218750e-01,
-5.2458968267846906030626996653154492378234863281250000e-01,
-5.2589502747108418656551975800539366900920867919921875e-01,
-5.2719913478190094657804820599267259240150451660156250e-01,
-5.2850200154222826132155432787840254604816436767578125e-01,
-5.2980362468629460526159391520195640623569488525390625e-01,
-5.3110400115125500075663467214326374232769012451171875e-01,
-5.3240312787719812348541381652466952800750732421875000e-01,
-5.3370100180715251969587598068756051361560821533203125e-01,
-5.3499761988709693127930222544819116592407226562500000e-01,
-5.3629297906596296030556914047338068485260009765625000e-01,
-5.3758707629564550511958032075199298560619354248046875e-01,
-5.3887990853100853350099441740894690155982971191406250e-01,
-5.4017147272989241013618766373838298022747039794921875e-01,
-5.4146176585312311146935826400294899940490722656250000e-01,
-5.4275078486451566739390273141907528042793273925781250e-01,
-5.4403852673088382019273012701887637376785278320312500e-01,
-5.4532498842204646383180488555808551609516143798828125e-01,
-5.4661016691083508245441180406487546861171722412109375e-01,
-5.4789405917309974558548901768517680466175079345703125e-01,
-5.4917666218771943320575701363850384950637817382812500e-01,
-5.5045797293660470028697773159365169703960418701171875e-01,
-5.5173798840470733573226880253059789538383483886718750e-01,
-5.5301670558002768984806607477366924285888671875000000e-01,
-5.5429412145361967034773442719597369432449340820312500e-01,
-5.5557023301960184458181402078480459749698638916015625e-01,
-5.5684503727515988202867447398602962493896484375000000e-01,
-5.5811853122055599119022417653468437492847442626953125e-01,
-5.5939071185913613604157035297248512506484985351562500e-01,
-5.6066157619733625327995696352445520460605621337890625e-01,
-5.6193112124468902468521491755382157862186431884765625e-01,
-5.6319934401383386912698369997087866067886352539062500e-01,
-5.6446624152051927403306308406172320246696472167968750e-01,
-5.6573181078361312046354214544408023357391357421875000e-01,
-5.6699604882510878933743470042827539145946502685546875e-01,
-5.6825895267013104561470981934689916670322418212890625e-01,
-5.6952051934694680745963069057324901223182678222656250e-01,
-5.7078074588696703361989648328744806349277496337890625e-01,
-5.7203962932475693747846889891661703586578369140625000e-01,
-5.7329716669804220430251007201150059700012207031250000e-01,
-5.7455335504771598564843770873267203569412231445312500e-01,
-5.7580819141784489456625806269585154950618743896484375e-01,
-5.7706167285567921965139248641207814216613769531250000e-01,
-5.7831379641165536753533160663209855556488037109375000e-01,
-5.7956455913940574387055448823957704007625579833984375e-01,
-5.8081395809576463751255914758075959980487823486328125e-01,
-5.8206199034077510390261522843502461910247802734375000e-01,
-5.8330865293769795787426346578286029398441314697265625e-01,
-5.8455394295301510432238956127548590302467346191406250e-01,
-5.8579785745643875305432857203413732349872589111328125e-01,
-5.8704039352091808012801266158930957317352294921875000e-01,
-5.8828154822264544510090900075738318264484405517578125e-01,
-5.8952131864106349645737736864248290657997131347656250e-01,
-5.9075970185887394237056469137314707040786743164062500e-01,
-5.9199669496204077034917645505629479885101318359375000e-01,
-5.9323229503979979515548848212347365915775299072265625e-01,
-5.9446649918466454298737744466052390635013580322265625e-01,
-5.9569930449243291281646861534682102501392364501953125e-01,
-5.9693070806219616919463533122325316071510314941406250e-01,
-5.9816070699634205087846794413053430616855621337890625e-01,
-5.9938929840056442976958805957110598683357238769531250e-01,
-6.0061647938386897305207412500749342143535614013671875e-01,
-6.0184224705858024861981903086416423320770263671875000e-01,
-6.0306659854034783130316554888850077986717224121093750e-01,
-6.0428953094815573976461564598139375448226928710937500e-01,
-6.0551104140432532307869450960424728691577911376953125e-01,
-6.0673112703452447558305493657826445996761322021484375e-01,
-6.0794978496777374310511277144541963934898376464843750e-01,
-6.0916701233645265123328726986073888838291168212890625e-01,
-6.1038280627630914221271041242289356887340545654296875e-01,
-6.1159716392646168436897369247162714600563049316406250e-01,
-6.1281008242940959718225713004358112812042236328125000e-01,
-6.1402155893103849138014993513934314250946044921875000e-01,
-6.1523159058062704129810072117834351956844329833984375e-01,
-6.1644017453085320212835540587548166513442993164062500e-01,
-6.1764730793780364681566652507171966135501861572265625e-01,
-6.1885298796097620854794740807847119867801666259765625e-01,
-6.2005721176328920662967902899254113435745239257812500e-01,
-6.2125997651108766373084790757275186479091644287109375e-01,
-6.2246127937414952313588401011656969785690307617187500e-01,
-6.2366111752569419746095036316546611487865447998046875e-01,
-6.2485948814238612136762185400584712624549865722656250e-01,
-6.2605638840434341130247730689006857573986053466796875e-01,
-6.2725181549514419376833984642871655523777008056640625e-01,
-6.2844576660183282257321479846723377704620361328125000e-01,
-6.2963823891492665119073990354081615805625915527343750e-01,
-6.3082922962842424841056754303281195461750030517578125e-01,
-6.3201873593980884002974107715999707579612731933593750e-01,
-6.3320675505005719063689184622489847242832183837890625e-01,
-6.3439328416364559881657214646111242473125457763671875e-01,
-6.3557832048855567030898328084731474518775939941406250e-01,
-6.3676186123628386592798733545350842177867889404296875e-01,
-6.3794390362184383302945889226975850760936737060546875e-01,
-6.3912444486377562036238941800547763705253601074218750e-01,
-6.4030348218415167327322023993474431335926055908203125e-01,
-6.4148101280858327299938537180423736572265625000000000e-01,
-6.4265703396622653187364448967855423688888549804687500e-01,
-6.4383154288979116408597747067688032984733581542968750e-01,
-6.4500453681554381635265826844261027872562408447265625e-01,
-6.4617601298331628356663713930174708366394042968750000e-01,
-6.4734596863651217013568839320214465260505676269531250e-01,
-6.4851440102211199700832366943359375000000000000000000e-01,
-6.4968130739068286061410617548972368240356445312500000e-01,
-6.5084668499638065330969993738108314573764801025390625e-01,
-6.5201053109695938925227665095007978379726409912109375e-01,
-6.5317284295377675551463880765368230640888214111328125e-01,
-6.5433361783180066240106498298700898885726928710937500e-01,
-6.5549285299961501660703788729733787477016448974609375e-01,
-6.5665054572942871402574382955208420753479003906250000e-01,
-6.5780669329707852632793674274580553174018859863281250e-01,
-6.5896129298203731661232041005860082805156707763671875e-01,
-6.6011434206742058972139375327969901263713836669921875e-01,
-6.6126583783999182131196903355885297060012817382812500e-01,
-6.6241577759017145066167131517431698739528656005859375e-01,
-6.6356415861203954520419756590854376554489135742187500e-01,
-6.6471097820334479333581612081616185605525970458984375e-01,
-6.6585623366550972246358242045971564948558807373046875e-01,
-6.6699992230363769341039414939587004482746124267578125e-01,
-6.6814204142651811846320697441115044057369232177734375e-01,
-6.6928258834663578724644139583688229322433471679687500e-01,
-6.7042156038017297614572953534661792218685150146484375e-01,
-6.7155895484701833009211213720845989882946014404296875e-01,
-6.7269476907077296878867400664603337645530700683593750e-01,
-6.7382900037875559373645728555857203900814056396484375e-01,
-6.7496164610201170308556584132020361721515655517578125e-01,
-6.7609270357531570105891205457737669348716735839843750e-01,
-6.7722217013718033484792613307945430278778076171875000e-01,
-6.7835004312986146857156199985183775424957275390625000e-01,
-6.7947631989936518870365489419782534241676330566406250e-01,
-6.8060099779545268905422972238739021122455596923828125e-01,
-6.8172407417164948562060544645646587014198303222656250e-01,
-6.8284554638524797010035172206698916852474212646484375e-01,
-6.8396541179731540349706619963399134576320648193359375e-01,
-6.8508366777270046643621981274918653070926666259765625e-01,
-6.8620031168003814414646512886974960565567016601562500e-01,
-6.8731534089175883028843827560194768011569976806640625e-01,
-6.8842875278409021433390080346725881099700927734375000e-01,
-6.8954054473706682948375146224861964583396911621093750e-01,
-6.9065071413453471560472962664789520204067230224609375e-01,
-6.9175925836415796954526058470946736633777618408203125e-01,
-6.9286617481742429625057866360293701291084289550781250e-01,
-6.9397146088965377952462176835979335010051727294921875e-01,
-6.9507511398000076940917324463953264057636260986328125e-01,
-6.9617713149146287499036134249763563275337219238281250e-01,
-6.9727751083088662653608480468392372131347656250000000e-01,
-6.9837624940897236047732121733133681118488311767578125e-01,
-6.9947334464028343425923139875521883368492126464843750e-01,
-7.0056879394324811372030126221943646669387817382812500e-01,
-7.0166259474016845487653881718870252370834350585937500e-01,
-7.0275474445722529992508498253300786018371582031250000e-01,
-7.0384524052448504960466379998251795768737792968750000e-01,
-7.0493408037590454817689078481635078787803649902343750e-01,
-7.0602126144933952112126007705228403210639953613281250e-01,
-7.0710678118654735069270600433810614049434661865234375e-01,
-7.0819063703319529157198530811001546680927276611328125e-01,
-7.0927282643886568891389288182836025953292846679687500e-01,
-7.1035334685706186252929228430730290710926055908203125e-01,
-7.1143219574521610049089304084191098809242248535156250e-01,
-7.1250937056469210162390481855254620313644409179687500e-01,
-7.1358486878079352422332704009022563695907592773437500e-01,
-7.1465868786276909307986215935670770704746246337890625e-01,
-7.1573082528381881672885356238111853599548339843750000e-01,
-7.1680127852109909447619884304003790020942687988281250e-01,
-7.1787004505573148716024434179416857659816741943359375e-01,
-7.1893712237280427146401962090749293565750122070312500e-01,
-7.2000250796138154374403939073090441524982452392578125e-01,
-7.2106619931450821603391432290663942694664001464843750e-01,
-7.2212819392921490102565940105705522000789642333984375e-01,
-7.2318848930652712692079830958391539752483367919921875e-01,
-7.2424708295146666969799298385623842477798461914062500e-01,
-7.2530397237306065694184553649392910301685333251953125e-01,
-7.2635915508434600873499675799394026398658752441406250e-01,
-7.2741262860237587695166894263820722699165344238281250e-01,
-7.2846439044822486330588162672938778996467590332031250e-01,
-7.2951443814699679091262396468664519488811492919921875e-01,
-7.3056276922782736882311382942134514451026916503906250e-01,
-7.3160938122389251869748250101110897958278656005859375e-01,
-7.3265427167241292671917562984162941575050354003906250e-01,
-7.3369743811465981675468128742068074643611907958984375e-01,
-7.3473887809596316600391219253651797771453857421875000e-01,
-7.3577858916571337033474264899268746376037597656250000e-01,
-7.3681656887736979300029815931338816881179809570312500e-01,
-7.3785281478846598268717116297921165823936462402343750e-01,
-7.3888732446061522463054416220984421670436859130859375e-01,
-7.3992009545951575866240546019980683922767639160156250e-01,
-7.4095112535495888383962892476120032370090484619140625e-01,
-7.4198041172083084582311585108982399106025695800781250e-01,
-7.4300795213512160763968950050184503197669982910156250e-01,
-7.4403374417992929057419360105996020138263702392578125e-01,
-7.4505778544146550324001054832478985190391540527343750e-01,
-7.4608007351006344620714116899762302637100219726562500e-01,
-7.4710060598017991040364904620219022035598754882812500e-01,
-7.4811938045040349276604274564306251704692840576171875e-01,
-7.4913639452345937019828170377877540886402130126953125e-01,
-7.5015164580621518375380674115149304270744323730468750e-01,
-7.5116513190968603463915087559144012629985809326171875e-01,
-7.5217685044904247781971662334399297833442687988281250e-01,
-7.5318679904361229837661539932014420628547668457031250e-01,
-7.5419497531688906022395713080186396837234497070312500e-01,
-7.5520137689653654700094875806826166808605194091796875e-01,
-7.5620600141439409114241243514697998762130737304687500e-01,
-7.5720884650648423441765544339432381093502044677734375e-01,
-7.5820990981301505939882190432399511337280273437500000e-01,
-7.5920918897838796102206515570287592709064483642578125e-01,
-7.6020668165120242054655363972415216267108917236328125e-01,
-7.6120238548426188973650141633697785437107086181640625e-01,
-7.6219629813457856482017405141959898173809051513671875e-01,
-7.6318841726338104702875853035948239266872406005859375e-01,
-7.6417874053611656304241250836639665067195892333984375e-01,
-7.6516726562245884757373914908384904265403747558593750e-01,
-7.6615399019631291732679301276220940053462982177734375e-01,
-7.6713891193581995597838840694748796522617340087890625e-01,
-7.6812202852336508573927176257711835205554962158203125e-01,
-7.6910333764557947677786842177738435566425323486328125e-01,
-7.7008283699334789673685008892789483070373535156250000e-01,
-7.7106052426181381775904810638166964054107666015625000e-01,
-7.7203639715038463453566919270087964832782745361328125e-01,
-7.7301045336273666030990625586127862334251403808593750e-01,
-7.7398269060682256537120338180102407932281494140625000e-01,
-7.7495310659487370852360754724941216409206390380859375e-01,
-7.7592169904340757558003360827569849789142608642578125e-01,
-7.7688846567323255332127018846222199499607086181640625e-01,
-7.7785340420945270345498556707752868533134460449218750e-01,
-7.7881651238147564519920251768780872225761413574218750e-01,
-7.7977778792301433163913770840736106038093566894531250e-01,
-7.8073722857209437719916422793176025152206420898437500e-01,
-7.8169483207105938671332978628925047814846038818359375e-01,
-7.8265059616657584040666506552952341735363006591796875e-01,
-7.8360451860963786785418960789684206247329711914062500e-01,
-7.8455659715557501954208419192582368850708007812500000e-01,
-7.8550682956405382117992530766059644520282745361328125e-01,
-7.8645521359908565628415999526623636484146118164062500e-01,
-7.8740174702903142911480927068623714148998260498046875e-01,
-7.8834642762660589454526416375301778316497802734375000e-01,
-7.8928925316888542962345809428370557725429534912109375e-01,
-7.9023022143730992095100873484625481069087982177734375e-01,
-7.9116933021769009215518053679261356592178344726562500e-01,
-7.9210657730021238887019308094750158488750457763671875e-01,
-7.9304196047944375269622696578153409063816070556640625e-01,
-7.9397547755433683924763954564696177840232849121093750e-01,
-7.9490712632823679051341514423256739974021911621093750e-01,
-7.9583690460888334428091184236109256744384765625000000e-01,
-7.9676481020841871671933631660067476332187652587890625e-01,
-7.9769084094339115509342263976577669382095336914062500e-01,
-7.9861499463476048887855540669988840818405151367187500e-01,
-7.9953726910790479109891748521476984024047851562500000e-01,
-8.0045766219262259877353926640353165566921234130859375e-01,
-8.0137617172314012936595872815814800560474395751953125e-01,
-8.0229279553811572167631993579561822116374969482421875e-01,
-8.0320753148064505388958878029370680451393127441406250e-01,
-8.0412037739826547344534901640145108103752136230468750e-01,
-8.0503133114296332450976478867232799530029296875000000e-01,
-8.0594039057117616842162988177733495831489562988281250e-01,
-8.0684755354379922298591054641292430460453033447265625e-01,
-8.0775281792619035847735631250543519854545593261718750e-01,
-8.0865618158817464955490095235290937125682830810546875e-01,
-8.0955764240405103659981023156433366239070892333984375e-01,
-8.1045719825259465718403362188837490975856781005859375e-01,
-8.1135484701706361843065451466827653348445892333984375e-01,
-8.1225058658520388199519857153063639998435974121093750e-01,
-8.1314441484925359393542976249591447412967681884765625e-01,
-8.1403632970594808071496117918286472558975219726562500e-01,
-8.1492632905652639951910032323212362825870513916015625e-01,
-8.1581441080673366972320081913494504988193511962890625e-01,
-8.1670057286682773423081016517244279384613037109375000e-01,
-8.1758481315158371138807069655740633606910705566406250e-01,
-8.1846712958029832485351562354480847716331481933593750e-01,
-8.1934752007679667595851924488670192658901214599609375e-01,
-8.2022598256943446415334619814530014991760253906250000e-01,
-8.2110251499110464834529921063221991062164306640625000e-01,
-8.2197711527924155472391021248768083751201629638671875e-01,
-8.2284978137582642787606346246320754289627075195312500e-01,
-8.2372051122739109452197681093821302056312561035156250e-01,
-8.2458930278502506894255930092185735702514648437500000e-01,
-8.2545615400437732933625056830351240932941436767578125e-01,
-8.2632106284566342324637844285462051630020141601562500e-01,
-8.2718402727366913129714021124527789652347564697265625e-01,
-8.2804504525775535217491096773301251232624053955078125e-01,
-8.2890411477186465294408890258637256920337677001953125e-01,
-8.2976123379452282335932977730408310890197753906250000e-01,
-8.3061640030884620333750945064821280539035797119140625e-01,
-8.3146961230254523567140267914510332047939300537109375e-01,
-8.3232086776792968407789885532110929489135742187500000e-01,
-8.3317016470191285204549558329745195806026458740234375e-01,
-8.3401750110601791110553904218249954283237457275390625e-01,
-8.3486287498637989923366831135354004800319671630859375e-01,
-8.3570628435375249321026558391167782247066497802734375e-01,
-8.3654772722351200542334481724537909030914306640625000e-01,
-8.3738720161566160271604530862532556056976318359375000e-01,
-8.3822470555483774568017452111234888434410095214843750e-01,
-8.3906023707031252012455979638616554439067840576171875e-01,
-8.3989379419599941023477640555938705801963806152343750e-01,
-8.4072537497045807253215343735064379870891571044921875e-01,
-8.4155497743689844369896491116378456354141235351562500e-01,
-8.4238259964318551453743566526100039482116699218750000e-01,
-8.4320823964184521415177187009248882532119750976562500e-01,
-8.4403189549006629732730289106257259845733642578125000e-01,
-8.4485356524970700586862903946894221007823944091796875e-01,
-8.4567324698729906540251022306620143353939056396484375e-01,
-8.4649093877405168218075459662941284477710723876953125e-01,
-8.4730663868585809339606385037768632173538208007812500e-01,
-8.4812034480329712149426768519333563745021820068359375e-01,
-8.4893205521163950244556417601415887475013732910156250e-01,
-8.4974176800085243765892073497525416314601898193359375e-01,
-8.5054948126560347976266029945691116154193878173828125e-01,
-8.5135519310526486247425737019511871039867401123046875e-01,
-8.5215890162391960682697344964253716170787811279296875e-01,
-8.5296060493036351957130136725027114152908325195312500e-01,
-8.5376030113811129940160071782884187996387481689453125e-01,
-8.5455798836540053375898651211173273622989654541015625e-01,
-8.5535366473519569563421782731893472373485565185546875e-01,
-8.5614732837519424979433324551791884005069732666015625e-01,
-8.5693897741782854016179271638975478708744049072265625e-01,
-8.5772861000027200706341545810573734343051910400390625e-01,
-8.5851622426444273994405875782831571996212005615234375e-01,
-8.5930181835700847337022878491552546620368957519531250e-01,
-8.6008539042938991769915446639060974121093750000000000e-01,
-8.6086693863776708735002785033429972827434539794921875e-01,
-8.6164646114308118818314596865093335509300231933593750e-01,
-8.6242395611104050168194135039811953902244567871093750e-01,
-8.6319942171212415971126574731897562742233276367187500e-01,
-8.6397285612158636336488370943698100745677947998046875e-01,
-8.6474425751946215612520063586998730897903442382812500e-01,
-8.6551362409056886715319478753372095525264739990234375e-01,
-8.6628095402451288364886750059667974710464477539062500e-01,
-8.6704624551569264845340967440279200673103332519531250e-01,
-8.6780949676330332298590519712888635694980621337890625e-01,
-8.6857070597134067302391713383258320391178131103515625e-01,
-8.6932987134860661981861085223499685525894165039062500e-01,
-8.7008699110871134951850081051816232502460479736328125e-01,
-8.7084206347007886428457368310773745179176330566406250e-01,
-8.7159508665595109011547947375220246613025665283203125e-01,
-8.7234605889439120751660539099248126149177551269531250e-01,
-8.7309497841828986874901374903856776654720306396484375e-01,
-8.7384184346536664111937398047302849590778350830078125e-01,
-8.7458665227817600218429561209632083773612976074218750e-01,
-8.7532940310411089246400706542772240936756134033203125e-01,
-8.7607009419540671224524430726887658238410949707031250e-01,
-8.7680872380914542940644196278299205005168914794921875e-01,
-8.7754529020726113053285644127754494547843933105468750e-01,
-8.7827979165654135318419548639212734997272491455078125e-01,
-8.7901222642863341416585853949072770774364471435546875e-01,
-8.7974259280004751815340569010004401206970214843750000e-01,
-8.8047088905216042142853893892606720328330993652343750e-01,
-8.8119711347122176015034256124636158347129821777343750e-01,
-8.8192126434835482751140034451964311301708221435546875e-01,
-8.8264333997956267996443102674675174057483673095703125e-01,
-8.8336333866573157891366463445592671632766723632812500e-01,
-8.8408125871263509854003359578200615942478179931640625e-01,
-8.8479709843093745647024661593604832887649536132812500e-01,
-8.8551085613619973102572657808195799589157104492187500e-01,
-8.8622253014888052735642531843041069805622100830078125e-01,
-8.8693211879434219468976152711547911167144775390625000e-01,
-8.8763962040285393495508969863294623792171478271484375e-01,
-8.8834503330959602163119370743515901267528533935546875e-01,
-8.8904835585466435166068777107284404337406158447265625e-01,
-8.8974958638307266589606570050818845629692077636718750e-01,
-8.9044872324475776714791663835057988762855529785156250e-01,
-8.9114576479458318392090632187318988144397735595703125e-01,
-8.9184070939234283414975834602955728769302368164062500e-01,
-8.9253355540276435586832803892320953309535980224609375e-01,
-8.9322430119551510241393543765298090875148773193359375e-01,
-8.9391294514520314162808745095389895141124725341796875e-01,
-8.9459948563138269594929852246423251926898956298828125e-01,
-8.9528392103855758410446696871076710522174835205078125e-01,
-8.9596624975618488484485624212538823485374450683593750e-01,
-8.9664647017867993294970574424951337277889251708984375e-01,
-8.9732458070541809558307022598455660045146942138671875e-01,
-8.9800057974073976829743060079636052250862121582031250e-01,
-8.9867446569395381672507028270047158002853393554687500e-01,
-8.9934623697934157338096383682568557560443878173828125e-01,
-9.0001589201615994628724592985236085951328277587890625e-01,
-9.0068342922864674804372953076381236314773559570312500e-01,
-9.0134884704602191707323299851850606501102447509765625e-01,
-9.0201214390249317975900567034841515123844146728515625e-01,
-9.0267331823725882600228942465037107467651367187500000e-01,
-9.0333236849451159500290486903395503759384155273437500e-01,
-9.0398929312344311615134984094765968620777130126953125e-01,
-9.0464409057824601845254619547631591558456420898437500e-01,
-9.0529675931811870448484569351421669125556945800781250e-01,
-9.0594729780726845902449895220343023538589477539062500e-01,
-9.0659570451491544584854409549734555184841156005859375e-01,
-9.0724197791529559431467077956767752766609191894531250e-01,
-9.0788611648766603945404085607151500880718231201171875e-01,
-9.0852811871630601014970807227655313909053802490234375e-01,
-9.0916798309052238025174119684379547834396362304687500e-01,
-9.0980570810465233311248312020325101912021636962890625e-01,
-9.1044129225806691430022965505486354231834411621093750e-01,
-9.1107473405517613862514281208859756588935852050781250e-01,
-9.1170603200542976729536803759401664137840270996093750e-01,
-9.1233518462332263698755241421167738735675811767578125e-01,
-9.1296219042839821256052346143405884504318237304687500e-01,
-9.1358704794525091852364084843429736793041229248046875e-01,
-9.1420975570353046890659243217669427394866943359375000e-01,
-9.1483031223794597508458537049591541290283203125000000e-01,
-9.1544871608826772213518552234745584428310394287109375e-01,
-9.1606496579933160973041594843380153179168701171875000e-01,
-9.1667905992104270485043571170535869896411895751953125e-01,
-9.1729099700837768427419405270484276115894317626953125e-01,
-9.1790077562139027467225105283432640135288238525390625e-01,
-9.1850839432521214078519733448047190904617309570312500e-01,
-9.1911385169005765938265994918765500187873840332031250e-01,
-9.1971714629122736095467871564324013888835906982421875e-01,
-9.2031827670911059424696532005327753722667694091796875e-01,
-9.2091724152918918999688457915908657014369964599609375e-01,
-9.2151403934204179080325047834776341915130615234375000e-01,
-9.2210866874334507237165325932437554001808166503906250e-01,
-9.2270112833387851747346530828508548438549041748046875e-01,
-9.2329141671952763559261256887111812829971313476562500e-01,
-9.2387953251128651643853118002880364656448364257812500e-01,
-9.2446547432526249288287090166704729199409484863281250e-01,
-9.2504924078267747322712466484517790377140045166015625e-01,
-9.2563083050987271516163445994607172906398773193359375e-01,
-9.2621024213831137927854797453619539737701416015625000e-01,
-9.2678747430458185974089246883522719144821166992187500e-01,
-9.2736252565040089290704372615437023341655731201171875e-01,
-9.2793539482261766515591716597555205225944519042968750e-01,
-9.2850608047321547822150478168623521924018859863281250e-01,
-9.2907458125931574599576379114296287298202514648437500e-01,
-9.2964089584318132519769051214097999036312103271484375e-01,
-9.3020502289221917990857946278993040323257446289062500e-01,
-9.3076696107898349019649231195216998457908630371093750e-01,
-9.3132670908118031505296130490023642778396606445312500e-01,
-9.3188426558166803648219911337946541607379913330078125e-01,
-9.3243962926846235550470964881242252886295318603515625e-01,
-9.3299279883473895669254716267460025846958160400390625e-01,
-9.3354377297883595065997042183880694210529327392578125e-01,
-9.3409255040425875904475105926394462585449218750000000e-01,
-9.3463912981968066961968588657327927649021148681640625e-01,
-9.3518350993894749922930031971191056072711944580078125e-01,
-9.3572568948108036934740994183812290430068969726562500e-01,
-9.3626566717027837061237960369908250868320465087890625e-01,
-9.3680344173592144940698744903784245252609252929687500e-01,
-9.3733901191257484875052341521950438618659973144531250e-01,
-9.3787237643998977443260400832514278590679168701171875e-01,
-9.3840353406310805794987572880927473306655883789062500e-01,
-9.3893248353206459899666924684424884617328643798828125e-01,
-9.3945922360218969693335111514898017048835754394531250e-01,
-9.3998375303401382474532965716207399964332580566406250e-01,
-9.4050607059326829517686974213575012981891632080078125e-01,
-9.4102617505088925753398143569938838481903076171875000e-01,
-9.4154406518302080630888895029784180223941802978515625e-01,
-9.4205973977101742367068482053582556545734405517578125e-01,
-9.4257319760144675502289146606926806271076202392578125e-01,
-9.4308443746609338376174491713754832744598388671875000e-01,
-9.4359345816196027456612682726699858903884887695312500e-01,
-9.4410025849127265917815066131879575550556182861328125e-01,
-9.4460483726148025684921094580204226076602935791015625e-01,
-9.4510719328526038296445221931207925081253051757812500e-01,
-9.4560732538052116868954044548445381224155426025390625e-01,
-9.4610523237040333732750241324538365006446838378906250e-01,
-9.4660091308328353498779961228137835860252380371093750e-01,
-9.4709436635277721716619225844624452292919158935546875e-01,
-9.4758559101774120225769593162112869322299957275390625e-01,
-9.4807458592227611404723575105890631675720214843750000e-01,
-9.4856134991573015646793010091641917824745178222656250e-01,
-9.4904588185270055689102264295797795057296752929687500e-01,
-9.4952818059303667475035126699367538094520568847656250e-01,
-9.5000824500184311016681704131769947707653045654296875e-01,
-9.5048607394948159132752607547445222735404968261718750e-01,
-9.5096166631157497128867817082209512591361999511718750e-01,
-9.5143502096900833819859144568908959627151489257812500e-01,
-9.5190613680793223494447374832816421985626220703125000e-01,
-9.5237501271976587879919406987028196454048156738281250e-01,
-9.5284164760119871573351701954379677772521972656250000e-01,
-9.5330604035419364006287423762842081487178802490234375e-01,
-9.5376818988599021409413580840919166803359985351562500e-01,
-9.5422809510910555630402996030170470476150512695312500e-01,
-9.5468575494133833814203171641565859317779541015625000e-01,
-9.5514116830577078243180721983662806451320648193359375e-01,
-9.5559433413077088381726298393914476037025451660156250e-01,
-9.5604525134999629454313208043458871543407440185546875e-01,
-9.5649391890239499058878891446511261165142059326171875e-01,
-9.5694033573220882438192802510457113385200500488281250e-01,
-9.5738450078897596728921826070290990173816680908203125e-01,
-9.5782641302753290801774710416793823242187500000000000e-01,
-9.5826607140801756123948962340364232659339904785156250e-01,
-9.5870347489587148803735772162326611578464508056640625e-01,
-9.5913862246184189430664446263108402490615844726562500e-01,
-9.5957151308198451733488809622940607368946075439453125e-01,
-9.6000214573766595727022377104731276631355285644531250e-01,
-9.6043051941556567552282785982242785394191741943359375e-01,
-9.6085663310767954747859675990184769034385681152343750e-01,
-9.6128048581132052863296166833606548607349395751953125e-01,
-9.6170207652912254037147476992686279118061065673828125e-01,
-9.6212140426904158019283386238384991884231567382812500e-01,
-9.6253846804435927442256115682539530098438262939453125e-01,
-9.6295326687368376639142297790385782718658447265625000e-01,
-9.6336579978095393528292333940044045448303222656250000e-01,
-9.6377606579543984022251379428780637681484222412109375e-01,
-9.6418406395174582890206238516839221119880676269531250e-01,
-9.6458979328981275802590289458748884499073028564453125e-01,
-9.6499325285492021375688409534632228314876556396484375e-01,
-9.6539444169768928727393131339340470731258392333984375e-01,
-9.6579335887408357397276859046542085707187652587890625e-01,
-9.6619000344541250413499255955684930086135864257812500e-01,
-9.6658437447833311928491184517042711377143859863281250e-01,
-9.6697647104485218161329385111457668244838714599609375e-01,
-9.6736629222232839442341401081648655235767364501953125e-01,
-9.6775383709347539973322227524477057158946990966796875e-01,
-9.6813910474636233338685542548773810267448425292968750e-01,
-9.6852209427441726674601341073866933584213256835937500e-01,
-9.6890280477642887202449628603062592446804046630859375e-01,
-9.6928123535654830966734607500256970524787902832031250e-01,
-9.6965738512429233697531572033767588436603546142578125e-01,
-9.7003125319454397423868385885725729167461395263671875e-01,
-9.7040283868755539131711884692776948213577270507812500e-01,
-9.7077214072895035013033293580519966781139373779296875e-01,
-9.7113915844972520385880443427595309913158416748046875e-01,
-9.7150389098625167250133927154820412397384643554687500e-01,
-9.7186633748027928536572517259628511965274810791015625e-01,
-9.7222649707893626924715135828591883182525634765625000e-01,
-9.7258436893473221296346764574991539120674133300781250e-01,
-9.7293995220556017677893123618559911847114562988281250e-01,
-9.7329324605469813569413872755831107497215270996093750e-01,
-9.7364424965081186602589014000841416418552398681640625e-01,
-9.7399296216795583358560861597652547061443328857421875e-01,
-9.7433938278557585821459952057921327650547027587890625e-01,
-9.7468351068851066809628491682815365493297576904296875e-01,
-9.7502534506699423122455527845886535942554473876953125e-01,
-9.7536488511665686562679411508725024759769439697265625e-01,
-9.7570213003852845901064938516356050968170166015625000e-01,
-9.7603707903903902387554580855066888034343719482421875e-01,
-9.7636973133002114000333904186845757067203521728515625e-01,
-9.7670008612871184183745754125993698835372924804687500e-01,
-9.7702814265775417279513703761040233075618743896484375e-01,
-9.7735390014519996082498209943878464400768280029296875e-01,
-9.7767735782450992942926859541330486536026000976562500e-01,
-9.7799851493455702833301756982109509408473968505859375e-01,
-9.7831737071962765472932233024039305746555328369140625e-01,
-9.7863392442942320759158292275969870388507843017578125e-01,
-9.7894817531906208607495045725954696536064147949218750e-01,
-9.7926012264908202098467882024124264717102050781250000e-01,
-9.7956976568544051886533452488947659730911254882812500e-01,
-9.7987710369951763755835827396367676556110382080078125e-01,
-9.8018213596811742949199697250151075422763824462890625e-01,
-9.8048486177346927394893327800673432648181915283203125e-01,
-9.8078528040323031955693977579358033835887908935546875e-01,
-9.8108339115048659451190360414329916238784790039062500e-01,
-9.8137919331375456089006092952331528067588806152343750e-01,
-9.8167268619698311304944127186900004744529724121093750e-01,
-9.8196386910955535398670690483413636684417724609375000e-01,
-9.8225274136628926147096763088484294712543487548828125e-01,
-9.8253930228744124075745958180050365626811981201171875e-01,
-9.8282355119870523640912551854853518307209014892578125e-01,
-9.8310548743121628501029363178531639277935028076171875e-01,
-9.8338511032155129232279477946576662361621856689453125e-01,
-9.8366241921173014350898711199988611042499542236328125e-01,
-9.8393741344921881175622502269106917083263397216796875e-01,
-9.8421009238692902520995176018914207816123962402343750e-01,
-9.8448045538322093150895852886606007814407348632812500e-01,
-9.8474850180190420800840911397244781255722045898437500e-01,
-9.8501423101223983813667928188806399703025817871093750e-01,
-9.8527764238894111059607894276268780231475830078125000e-01,
-9.8553873531217606185350632586050778627395629882812500e-01,
-9.8579750916756736511814551704446785151958465576171875e-01,
-9.8605396334619543896593540921458043158054351806640625e-01,
-9.8630809724459866938417462733923457562923431396484375e-01,
-9.8655991026477529715066339122131466865539550781250000e-01,
-9.8680940181418541623514784077997319400310516357421875e-01,
-9.8705657130575097379932003605063073337078094482421875e-01,
-9.8730141815785832370977459504501894116401672363281250e-01,
-9.8754394179435933676103331890772096812725067138671875e-01,
-9.8778414164457217783166242952574975788593292236328125e-01,
-9.8802201714328352633032181984162889420986175537109375e-01,
-9.8825756773074946437418475397862493991851806640625000e-01,
-9.8849079285269658701196249239728786051273345947265625e-01,
-9.8872169196032377858074369214591570198535919189453125e-01,
-9.8895026451030298986211164447013288736343383789062500e-01,
-9.8917650996478090341668121254770085215568542480468750e-01,
-9.8940042779138026585172838167636655271053314208984375e-01,
-9.8962201746320077599960995939909480512142181396484375e-01,
-9.8984127845882052820769558820757083594799041748046875e-01,
-9.9005821026229712256139237069874070584774017333984375e-01,
-9.9027281236316910817407688227831386029720306396484375e-01,
-9.9048508425645698238781733380164951086044311523437500e-01,
-9.9069502544266463406330558427725918591022491455078125e-01,
-9.9090263542778000971367191596073098480701446533203125e-01,
-9.9110791372327677883902197208954021334648132324218750e-01,
-9.9131085984611544414946138203958980739116668701171875e-01,
-9.9151147331874389667660807390348054468631744384765625e-01,
-9.9170975366909941417503659977228380739688873291015625e-01,
-9.9190570043060932725609291082946583628654479980468750e-01,
-9.9209931314219179654401159496046602725982666015625000e-01,
-9.9229059134825736698815035197185352444648742675781250e-01,
-9.9247953459871007808601461874786764383316040039062500e-01,
-9.9266614244894790797246741931303404271602630615234375e-01,
-9.9285041445986499386577861514524556696414947509765625e-01,
-9.9303235019785141002301998014445416629314422607421875e-01,
-9.9321194923479450000769475082051940262317657470703125e-01,
-9.9338921114808065304657702654367312788963317871093750e-01,
-9.9356413552059530402971176954451948404312133789062500e-01,
-9.9373672194072459884495174264884553849697113037109375e-01,
-9.9390697000235606051177228437154553830623626708984375e-01,
-9.9407487930487936633738854652619920670986175537109375e-01,
-9.9424044945318790222898996944422833621501922607421875e-01,
-9.9440368005767909576064766952185891568660736083984375e-01,
-9.9456457073425541537403660186100751161575317382812500e-01,
-9.9472312110432570264606511045712977647781372070312500e-01,
-9.9487933079480561637808477826183661818504333496093750e-01,
-9.9503319943811863179661258982378058135509490966796875e-01,
-9.9518472667219692873175063141388818621635437011718750e-01,
-9.9533391214048216877330332863493822515010833740234375e-01,
-9.9548075549192693856070945912506431341171264648437500e-01,
-9.9562525638099430569383230249513871967792510986328125e-01,
-9.9576741446765981713440396561054512858390808105468750e-01,
-9.9590722941741172125063030762248672544956207275390625e-01,
-9.9604470090125196701791310260887257754802703857421875e-01,
-9.9617982859569687015266481466824188828468322753906250e-01,
-9.9631261218277800129072829804499633610248565673828125e-01,
-9.9644305135004263007658664719201624393463134765625000e-01,
-9.9657114579055483538638782192720100283622741699218750e-01,
-9.9669689520289606043945696001173928380012512207031250e-01,
-9.9682029929116566790980868972837924957275390625000000e-01,
-9.9694135776498205014917175503796897828578948974609375e-01,
-9.9706007033948296225389640312641859054565429687500000e-01,
-9.9717643673532607717646669698297046124935150146484375e-01,
-9.9729045667869020697082760307239368557929992675781250e-01,
-9.9740212990127530279238499133498407900333404541015625e-01,
-9.9751145614030345409872779782745055854320526123046875e-01,
-9.9761843513851955478344279981683939695358276367187500e-01,
-9.9772306664419163624302200332749634981155395507812500e-01,
-9.9782535041111164453297988075064495205879211425781250e-01,
-9.9792528619859599547936568342265672981739044189453125e-01,
-9.9802287377148612979027575420332141220569610595703125e-01,
-9.9811811290014917918966830256977118551731109619140625e-01,
-9.9821100336047818846196832964778877794742584228515625e-01,
-9.9830154493389278158588240330573171377182006835937500e-01,
-9.9838973740734016093512082079541869461536407470703125e-01,
-9.9847558057329477421149022120516747236251831054687500e-01,
-9.9855907422975931364561574810068123042583465576171875e-01,
-9.9864021818026516008615089958766475319862365722656250e-01,
-9.9871901223387293811128984089009463787078857421875000e-01,
-9.9879545620517240500646494183456525206565856933593750e-01,
-9.9886954991428356098737140200682915747165679931640625e-01,
-9.9894129318685687124457217578310519456863403320312500e-01,
-9.9901068585407326594349797233007848262786865234375000e-01,
-9.9907772775264536146977434327709488570690155029296875e-01,
-9.9914241872481690531770937013789080083370208740234375e-01,
-9.9920475861836388631331828946713358163833618164062500e-01,
-9.9926474728659442359202103034476749598979949951171875e-01,
-9.9932238458834943273245698946993798017501831054687500e-01,
-9.9937767038800284780108995619229972362518310546875000e-01,
-9.9943060455546173237451057502767071127891540527343750e-01,
-9.9948118696616694567325112075195647776126861572265625e-01,
-9.9952941750109314256178549840115010738372802734375000e-01,
-9.9957529604674921763773909333394840359687805175781250e-01,
-9.9961882249517863829879615877871401607990264892578125e-01,
-9.9965999674395922269809489080216735601425170898437500e-01,
-9.9969881869620424996725205346592701971530914306640625e-01,
-9.9973528826056168306024574121693149209022521972656250e-01,
-9.9976940535121527897644000404397957026958465576171875e-01,
-9.9980116988788425569367745993076823651790618896484375e-01,
-9.9983058179582340319058175737154670059680938720703125e-01,
-9.9985764100582386060267481298069469630718231201171875e-01,
-9.9988234745421256111086449891445226967334747314453125e-01,
-9.9990470108285289807525941796484403312206268310546875e-01,
-9.9992470183914450299056397852837108075618743896484375e-01,
-9.9994234967602391161989316969993524253368377685546875e-01,
-9.9995764455196389786095778617891483008861541748046875e-01,
-9.9997058643097413987987920336308889091014862060546875e-01,
-9.9998117528260110908888691483298316597938537597656250e-01,
-9.9998941108192840321322591989883221685886383056640625e-01,
-9.9999529380957619117964441102230921387672424316406250e-01,
-9.9999882345170187925020854891045019030570983886718750e-01,
-};
-
-#endif
@@ -32,7 +32,100 @@
 // with zeros. 
 //
 // dft() is also supplied with the same interface as fft()
-// but will transform arbitrary sized data (albeit slowly).
+// but will transform arbitrary sized data, in O(N log N).
+// Lengths whose prime factors are all 2, 3, 5 or 7 (such as
+// 120, 360, 600 and 1000) use a mixed radix transform, and
+// other lengths use Bluestein's algorithm.
+// Unlike fft(), the forward dft() result is not normalised,
+// whilst the inverse is normalised by 1/N.
+//
+// fft_plan_create() precomputes the bit reversal permutation
+// and twiddle factors for a given length, so that repeated
+// transforms of that length, via fft_plan_execute(), do no
+// per-call set up. fft_plan_destroy() releases a plan. fft()
+// itself keeps a plan for the last length it was called with.
+//
+// fft_plan_create_alg() is as fft_plan_create(), but selects
+// the algorithm: FFT_ALG_DIT (the default, in place with a bit
+// reversal pass) or FFT_ALG_STOCKHAM (self sorting, using a
+// work buffer in the plan, so a Stockham plan must not be
+// executed by two threads at once).
+//
+// fft_real() and fft_plan_execute_real() do a forward transform
+// of real data in[] into the full, conjugate symmetric, spectrum
+// in out[], using a half length complex transform.
+//
+// The _pruned() variants take a count of the leading points
+// which may be non-zero, and skip butterflies of zero inputs.
+//
+// fft_set_simd() limits the SIMD instructions used for the
+// butterflies (FFT_SIMD_NONE, FFT_SIMD_SSE2 or FFT_SIMD_AVX2)
+// to no more than 'level', and returns the level in use. By
+// default the highest the CPU supports is used.
+//
+// fft_batch() transforms 'count' arrays of N points, one after
+// another in bufs[], as count calls of fft() would, but
+// doing the same butterfly of several arrays together.
+//
+// fft_set_threads() sets the number of threads used for large
+// transforms when compiled with OpenMP (0 for the OpenMP
+// default, -1 to leave unchanged), returning the number that
+// will be used. fft_set_sixstep() sets the smallest length
+// done with the cache blocked six step transform (0 for the
+// default, -1 to leave unchanged), returning the length set.
+//
+// fft_set_wisdom() names a file of 'wisdom': the fastest
+// algorithm, SIMD level and six step use for each length, as
+// timed on this host for the pruned real input transform
+// that filter() does. The plans kept by fft() and the other
+// functions keeping a plan follow it, but fft_plan_create()
+// always makes a DIT plan, so that threads may share it.
+// With 'autotune' non-zero, lengths with no wisdom are
+// timed on first use and the file updated, so later runs
+// need no tuning. fft_tune() times a length straight away.
+// Their _r versions put any error message in a context.
+// The single precision split transforms have stages of their
+// own, so take no notice of the wisdom. (See fft_tune.c.)
+//
+// split_complex_t holds data as separate real and imaginary
+// arrays, for loops which vectorise better over that layout.
+// fft_split.c has functions to allocate and convert to and
+// from split data, and fft_plan_execute_split() to transform
+// it. Each has a single precision version, with an _f suffix,
+// for split_complex_f_t data.
+//
+// fft_real_pruned_f() is as fft_real_pruned(), but does the
+// transform in single precision, for when the input needs
+// no more accuracy (e.g. quantised coefficients).
+//
+// fft_zoom() evaluates the spectrum of the N points of x[] at
+// M frequencies, evenly spaced from f1 to f2 inclusive (in
+// cycles per sample, so 0.5 is Fs/2), into X[], with a
+// chirp-z transform. The results are as fft() would give
+// for the same frequencies (exp(+j 2 Pi f n), normalised by
+// 1/N), but need no zero padding for a fine bin spacing,
+// and N need not be a power of 2.
+//
+// fft_probe() evaluates the spectrum of the N real points of
+// in[] at K arbitrary frequencies f[] (in cycles per sample),
+// into X[], with the same sign and normalisation as fft().
+// Each costs O(N), with a Goertzel recurrence, so for a few
+// frequencies this is much cheaper than a full transform.
+//
+// fft(), dft() and the other functions keeping a plan, or
+// setting fft_error_msg, share state between all callers, so
+// are not thread safe. Each has a reentrant version, with an
+// _r suffix, taking an fft_ctx_t which holds the plan, the
+// error message and the six step transform's work buffer
+// instead. A context is set up with fft_ctx_init() and its
+// plan and buffer released with fft_ctx_free().
+// Threads each with their own context, or their own plans,
+// may then transform at the same time, as may threads sharing
+// a DIT plan. The _r functions not keeping a plan accept a
+// NULL context, discarding the error message.
+// fft_set_simd(), fft_set_threads() and fft_set_sixstep()
+// change settings for the whole process, so should be called
+// before any threads are started.
 //
 // PARAMETERS:
 //
@@ -42,16 +135,34 @@
 //           this array.
 //
 // N       - int containing length of data array. Must be power
-//           of 2 if calling fft().
+//           of 2 if calling fft() or fft_real().
 //
 // inverse - int flag. If non-zero, inverse (synthesis)
 //           transform perfomed.
 //
+// plan    - fft_plan_t pointer, as returned by fft_plan_create().
+//
+// in[]    - 'real_t' array of real input data, for fft_real().
+//
+// out[]   - 'complex_t' array for the transformed real data.
+//
+// nonzero - int count of leading non-zero points, for the
+//           _pruned() functions. Later points are not read.
+//
+// ctx     - fft_ctx_t pointer, for the _r functions.
+//
+// X[], M, f1, f2 - fft_zoom() results, their number, and the
+//           first and last frequencies in cycles per sample.
+//
+// f[], K  - fft_probe() frequencies, in cycles per sample,
+//           and their number.
+//
 // RETURN:
 //
-// Both fft() and dft() return either FFT_OKSTATUS or 
-// FFT_ERRORSTATUS. For the latter, fft_error_msg points
-// to an error message string. Subsequent calls to fft or
+// fft_plan_create() returns NULL on error. The other functions
+// return either FFT_OKSTATUS or FFT_ERRORSTATUS. For the latter,
+// fft_error_msg (or ctx->msg for the _r functions) points to an
+// error message string. Subsequent calls to fft or
 // dft will clear any previous message. Transformed data
 // placed in array pointed to by array[].
 //
@@ -72,6 +183,25 @@
 #define FFT_ERRORSTATUS 1
 #define FFT_OKSTATUS    0
 
+// Algorithms for fft_plan_create_alg()
+#define FFT_ALG_DIT      0
+#define FFT_ALG_STOCKHAM 1
+
+// Byte alignment of split complex arrays
+#define SPLIT_ALIGN     64
+
+// Length of an error message buffer, including the terminator
+#define FFT_MSGLEN      256
+
+// SIMD levels for fft_set_simd()
+#define FFT_SIMD_NONE   0
+#define FFT_SIMD_SSE2   1
+#define FFT_SIMD_AVX2   2
+
+// Plan six step use, other than 0 (never) or 1 (always), choosing
+// by length as set with fft_set_sixstep()
+#define FFT_SIXSTEP_AUTO -1
+
 // -------------------------------------------------------------------------
 // TYPEDEFS
 // -------------------------------------------------------------------------
@@ -85,6 +215,48 @@ typedef struct {
     real_t i;
 } complex_t;
 
+// FFT plan, holding the precomputed tables for a given length
+typedef struct fft_plan_s {
+    int        length;
+    int        algorithm; // FFT_ALG_DIT or FFT_ALG_STOCKHAM
+    int       *bitrev;   // Bit reversed index of each point
+    complex_t *twiddle;  // W(k, n) for each n point stage, at offset n/2-1
+    complex_t *twiddle4; // W(k, n), W(2k, n), W(3k, n) for each n point radix-4 stage, at offset 3(n/4-1)
+    complex_t *work;     // Ping-pong buffer for FFT_ALG_STOCKHAM
+    real_t    *twiddle4_re; // Split twiddle4, as runs of W(k, n), W(2k, n), W(3k, n) for each stage,
+                            // made on first split execution (see fft_split.c)
+    real_t    *twiddle4_im;
+    float     *twiddle4f_re; // Single precision copies of twiddle4_re and twiddle4_im, made on
+                             // first single precision split execution
+    float     *twiddle4f_im;
+    struct fft_plan_s *sub; // Plan for the rows of a six step transform
+    int        simd;     // Highest SIMD level to use (the CPU's, unless tuned lower)
+    int        sixstep;  // Whether to use the six step transform, or FFT_SIXSTEP_AUTO
+} fft_plan_t;
+
+// Caller owned state for the reentrant (_r) functions
+typedef struct {
+    fft_plan_t *plan;            // Plan kept for the last length transformed
+    char        msg[FFT_MSGLEN]; // Error message from the last failed call
+    complex_t  *scratch;         // Six step work buffer, grown as needed
+    int         scratch_len;     // Points in scratch
+} fft_ctx_t;
+
+// Split complex data, with separate, SPLIT_ALIGN aligned, real
+// and imaginary arrays (see fft_split.c)
+typedef struct {
+    int     length;
+    real_t *re;
+    real_t *im;
+} split_complex_t;
+
+// Single precision split complex data
+typedef struct {
+    int     length;
+    float  *re;
+    float  *im;
+} split_complex_f_t;
+
 // -------------------------------------------------------------------------
 // PROTOTYPES
 // -------------------------------------------------------------------------
@@ -93,7 +265,83 @@ typedef struct {
 extern int fft (complex_t array[], const int N, const int inverse);
 extern int dft (complex_t array[], const int N, const int inverse);
 
-// Error message pointer
+extern fft_plan_t *fft_plan_create  (const int N);
+extern fft_plan_t *fft_plan_create_alg (const int N, const int algorithm);
+extern int         fft_plan_execute (const fft_plan_t *plan, complex_t array[], const int inverse);
+extern void        fft_plan_destroy (fft_plan_t *plan);
+
+extern int fft_real              (const real_t in[], complex_t out[], const int N);
+extern int fft_plan_execute_real (const fft_plan_t *plan, const real_t in[], complex_t out[]);
+
+extern int fft_pruned                   (complex_t array[], const int N, const int nonzero, const int inverse);
+extern int fft_real_pruned              (const real_t in[], complex_t out[], const int N, const int nonzero);
+extern int fft_plan_execute_pruned      (const fft_plan_t *plan, complex_t array[], const int nonzero, const int inverse);
+extern int fft_plan_execute_real_pruned (const fft_plan_t *plan, const real_t in[], complex_t out[], const int nonzero);
+
+extern int fft_batch              (complex_t bufs[], const int N, const int count, const int inverse);
+extern int fft_plan_execute_batch (const fft_plan_t *plan, complex_t bufs[], const int count, const int inverse);
+
+extern int fft_set_simd    (const int level);
+extern int fft_set_threads (const int threads);
+extern int fft_set_sixstep (const int N);
+
+// Split complex functions (fft_split.c)
+extern int  split_alloc            (split_complex_t *s, const int N);
+extern void split_free             (split_complex_t *s);
+extern void complex_to_split       (const complex_t in[], split_complex_t *out);
+extern void split_to_complex       (const split_complex_t *in, complex_t out[]);
+extern int  fft_plan_execute_split (const fft_plan_t *plan, split_complex_t *x, const int inverse);
+extern int  fft_plan_execute_real_split (const fft_plan_t *plan, const real_t in[], split_complex_t *out, const int nonzero);
+
+extern int  split_alloc_f            (split_complex_f_t *s, const int N);
+extern void split_free_f             (split_complex_f_t *s);
+extern void complex_to_split_f       (const complex_t in[], split_complex_f_t *out);
+extern void split_to_complex_f       (const split_complex_f_t *in, complex_t out[]);
+extern int  fft_plan_execute_split_f (const fft_plan_t *plan, split_complex_f_t *x, const int inverse);
+extern int  fft_plan_execute_real_split_f (const fft_plan_t *plan, const real_t in[], split_complex_f_t *out, const int nonzero);
+
+// Single precision pruned real transform, with double results
+extern int fft_real_pruned_f (const real_t in[], complex_t out[], const int N, const int nonzero);
+
+// Chirp-z zoom over a band of frequencies
+extern int fft_zoom (const complex_t x[], const int N, complex_t X[], const int M, const real_t f1, const real_t f2);
+
+// Autotuning (fft_tune.c)
+extern int         fft_set_wisdom          (const char *path, const int autotune);
+extern int         fft_tune                (const int N);
+extern int         fft_set_wisdom_r        (fft_ctx_t *ctx, const char *path, const int autotune);
+extern int         fft_tune_r              (fft_ctx_t *ctx, const int N);
+extern fft_plan_t *fft_plan_create_tuned_r (fft_ctx_t *ctx, const int N);
+
+// Goertzel evaluation at a list of frequencies
+extern int fft_probe (const real_t in[], const int N, const real_t f[], const int K, complex_t X[]);
+
+// Reentrant functions, keeping their plan and error message in a
+// caller owned context
+extern void fft_ctx_init (fft_ctx_t *ctx);
+extern void fft_ctx_free (fft_ctx_t *ctx);
+
+extern int fft_r               (fft_ctx_t *ctx, complex_t array[], const int N, const int inverse);
+extern int dft_r               (fft_ctx_t *ctx, complex_t array[], const int N, const int inverse);
+extern int fft_pruned_r        (fft_ctx_t *ctx, complex_t array[], const int N, const int nonzero, const int inverse);
+extern int fft_real_r          (fft_ctx_t *ctx, const real_t in[], complex_t out[], const int N);
+extern int fft_real_pruned_r   (fft_ctx_t *ctx, const real_t in[], complex_t out[], const int N, const int nonzero);
+extern int fft_real_pruned_f_r (fft_ctx_t *ctx, const real_t in[], complex_t out[], const int N, const int nonzero);
+extern int fft_batch_r         (fft_ctx_t *ctx, complex_t bufs[], const int N, const int count, const int inverse);
+extern int fft_zoom_r          (fft_ctx_t *ctx, const complex_t x[], const int N, complex_t X[], const int M,
+                                const real_t f1, const real_t f2);
+extern int fft_probe_r         (fft_ctx_t *ctx, const real_t in[], const int N, const real_t f[], const int K,
+                                complex_t X[]);
+
+extern fft_plan_t *fft_plan_create_r (fft_ctx_t *ctx, const int N, const int algorithm);
+extern int fft_plan_execute_pruned_r      (fft_ctx_t *ctx, const fft_plan_t *plan, complex_t array[],
+                                           const int nonzero, const int inverse);
+extern int fft_plan_execute_real_pruned_r (fft_ctx_t *ctx, const fft_plan_t *plan, const real_t in[],
+                                           complex_t out[], const int nonzero);
+extern int fft_plan_execute_batch_r       (fft_ctx_t *ctx, const fft_plan_t *plan, complex_t bufs[],
+                                           const int count, const int inverse);
+
+// Error message pointer, for the functions which are not reentrant
 extern char *fft_error_msg;
 
 #endif
@@ -46,6 +46,9 @@ typedef double real_t;
 typedef unsigned int uint_t;
 typedef unsigned char uchar_t;
 
+/* Most frequencies the response may be probed at */
+#define MAXPROBES 32
+
 /* Configuration parameter structure */
 typedef struct { 
     uint_t     opimpulse  : 1;
@@ -62,13 +65,14 @@ typedef struct {
     uint_t     automode   : 1;
     uint_t     normalise  : 1;
     uint_t     symimpulse : 1;
-    real_t     (*windowfunc)();
     FILE       *fp;
     FILE       *wfp;
-    uchar_t    window;
+    uchar_t    window;    /* Window type, as -w option character */
     char       *filename;
     char       *wfilename;
     char       *plotprog;
+    char       *wisdom;   /* FFT wisdom file (NULL for none) */
+    long       wincache;  /* Window cache budget in Kbytes (0 for none) */
     real_t     a;
     real_t     ripple;
     long       Q;
@@ -78,7 +82,12 @@ typedef struct {
     real_t     Fw;
     real_t     Fs;
     real_t     Ft;
-    real_t     attenuation;} ConfigStruct;
+    real_t     attenuation;
+    real_t     Fz1;       /* Zoomed response band, Fz1 to Fz2 Hz, */
+    real_t     Fz2;
+    long       Nz;        /* over Nz points (0 for no zoom) */
+    real_t     Fp[MAXPROBES]; /* Probed response frequencies in Hz, */
+    long       Np;        /* and their number (0 for no probing) */} ConfigStruct;
 
 
 #ifdef WIN32
@@ -130,7 +139,6 @@ typedef long long long64;
 /* Configuraton default values */
 #define DEFAULT_winchar        'h'
 #define DEFAULT_wstr            "Hamming"
-#define DEFAULT_windowfunc      hamming
 #define DEFAULT_opimpulse       FALSE
 #define DEFAULT_opwindow        FALSE
 #define DEFAULT_inversion       FALSE
@@ -147,6 +155,8 @@ typedef long long long64;
 #define DEFAULT_filename        "filter.dat"
 #define DEFAULT_winfilename     "window.dat"
 #define DEFAULT_plotprog        XPLOTPROG
+#define DEFAULT_wisdom          NULL
+#define DEFAULT_wincache        (WINDOW_CACHE_DEFAULT / 1024)
 #define DEFAULT_removeplot      FALSE
 #define DEFAULT_ripple          0.0
 #define DEFAULT_Fd              -1.0
@@ -158,6 +168,13 @@ typedef long long long64;
 #define DEFAULT_Fs              192000.0 
 #define DEFAULT_Ft              4000.0
 #define DEFAULT_attenuation     -60.0
+#define DEFAULT_Fz1             0.0
+#define DEFAULT_Fz2             0.0
+#define DEFAULT_Nz              0
+#define DEFAULT_Np              0
+
+/* Number of zoomed response points if none specified */
+#define DEFAULT_ZOOMPOINTS      1024
 
 /* So useful, make it a definition */
 //#define TWOPI (real_t)(2.00 * PI)
@@ -165,9 +182,28 @@ typedef long long long64;
 /* Macro to turn the specified bit width into a scaling factor */
 #define SCALEFACTOR (real_t)(C->Q ? (((long64)1<<((long64)(C->Q-1))) - (long64)(C->symimpulse ? 0 : 1)) : 1)
 
+/* Largest quantisation (in bits) for which the frequency response is
+   calculated in single precision, its rounding errors then being well
+   below those of the quantisation. Single precision coefficients
+   (Q = -1) have stopbands down to about -140dB, which single precision
+   rounding would disturb, so use double precision. */
+#define FLOATMAXQ 20
+
+/* Macro for whether the response of configuration C can be calculated
+   in single precision */
+#define FLOATRESPONSE(C) ((C)->Q > 0 && (C)->Q <= FLOATMAXQ)
+
 /* Actual number of coefficients to be output (i.e. padded with 0s) */
 #define COEFFTOTAL (4 * 1024)
 
+/* Number of response points filter() returns for configuration C: the
+   full response, followed by any zoomed response */
+#define RESPONSETOTAL(C) (COEFFTOTAL + ((C)->opimpulse ? 0 : (C)->Nz))
+
+/* Whether filter() returns only the response at the probe frequencies,
+   in place of the full response */
+#define PROBING(C) (!(C)->opimpulse && (C)->Np > 0)
+
 #define SMALLNUMBER -1e-35
 
 // -------------------------------------------------------------------------
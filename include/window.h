@@ -28,6 +28,8 @@
 // INCLUDES
 // -------------------------------------------------------------------------
 
+#include <stddef.h>
+
 #include "fft.h"
 
 // -------------------------------------------------------------------------
@@ -52,6 +54,9 @@
 
 #define BADWINDOWSTATUS 1
 
+/* Initial memory budget for cached window tables, in bytes */
+#define WINDOW_CACHE_DEFAULT  (1024 * 1024)
+
 // -------------------------------------------------------------------------
 // TYPEDEFS
 // -------------------------------------------------------------------------
@@ -87,6 +92,11 @@ extern real_t            kaiser               (const real_t, const real_t, const
 extern real_t            gauss                (const real_t, const real_t, const real_t);
 extern real_t            chebyshev            (const real_t, const real_t, const real_t);
 extern KaiserParamStruct design_kaiser_filter (const real_t, const real_t, const real_t);
+extern int               window_fill          (const int, const real_t, const int, real_t *);
+
+/* Window table cache (window_cache.c) */
+extern int               window_cache_fill    (const int, const real_t, const int, real_t *);
+extern void              window_cache_budget  (const size_t);
 
 #endif
 